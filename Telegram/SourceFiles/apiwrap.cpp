@@ -91,6 +91,8 @@ constexpr auto kForwardMessagesOnAdd = 100;
 constexpr auto kTopPromotionInterval = TimeId(60 * 60);
 constexpr auto kTopPromotionMinDelay = TimeId(10);
 constexpr auto kSmallDelayMs = 5;
+constexpr auto kMessageDataResolveTimeout = crl::time(20);
+constexpr auto kMaxMessageDatasPerRequest = 100;
 constexpr auto kUnreadMentionsPreloadIfLess = 5;
 constexpr auto kUnreadMentionsFirstRequestLimit = 10;
 constexpr auto kUnreadMentionsNextRequestLimit = 100;
@@ -230,7 +232,7 @@ bool ApiWrap::BlockedUsersSlice::operator!=(const BlockedUsersSlice &other) cons
 ApiWrap::ApiWrap(not_null<Main::Session*> session)
 : MTP::Sender(session->account().mtp())
 , _session(session)
-, _messageDataResolveDelayed([=] { resolveMessageDatas(); })
+, _messageDataResolveTimer([=] { resolveMessageDatas(); })
 , _webPagesTimer([=] { resolveWebPages(); })
 , _draftsSaveTimer([=] { saveDraftsToCloud(); })
 , _featuredSetsReadTimer([=] { readFeaturedSets(); })
@@ -611,15 +613,20 @@ void ApiWrap::requestMessageData(ChannelData *channel, MsgId msgId, RequestMessa
 	if (callback) {
 		req.callbacks.append(callback);
 	}
-	if (!req.requestId) _messageDataResolveDelayed.call();
+	if (!req.requestId && !_messageDataResolveTimer.isActive()) {
+		// Give the burst of materializing views a chance to add their
+		// ids before the batched request actually goes out.
+		_messageDataResolveTimer.callOnce(kMessageDataResolveTimeout);
+	}
 }
 
 QVector<MTPInputMessage> ApiWrap::collectMessageIds(const MessageDataRequests &requests) {
 	auto result = QVector<MTPInputMessage>();
-	result.reserve(requests.size());
+	result.reserve(std::min(requests.size(), kMaxMessageDatasPerRequest));
 	for (auto i = requests.cbegin(), e = requests.cend(); i != e; ++i) {
 		if (i.value().requestId > 0) continue;
 		result.push_back(MTP_inputMessageID(MTP_int(i.key())));
+		if (result.size() == kMaxMessageDatasPerRequest) break;
 	}
 	return result;
 }
@@ -641,8 +648,23 @@ ApiWrap::MessageDataRequests *ApiWrap::messageDataRequests(ChannelData *channel,
 void ApiWrap::resolveMessageDatas() {
 	if (_messageDataRequests.isEmpty() && _channelMessageDataRequests.isEmpty()) return;
 
-	auto ids = collectMessageIds(_messageDataRequests);
-	if (!ids.isEmpty()) {
+	// Tags exactly the requests whose ids were just collected, relying on
+	// collectMessageIds() walking the map in the very same order.
+	const auto markRequestSent = [](
+			MessageDataRequests &requests,
+			int count,
+			mtpRequestId requestId) {
+		for (auto &request : requests) {
+			if (request.requestId > 0) continue;
+			request.requestId = requestId;
+			if (!--count) break;
+		}
+	};
+	while (true) {
+		auto ids = collectMessageIds(_messageDataRequests);
+		if (ids.isEmpty()) {
+			break;
+		}
 		auto requestId = request(MTPmessages_GetMessages(
 			MTP_vector<MTPInputMessage>(ids)
 		)).done([this](const MTPmessages_Messages &result, mtpRequestId requestId) {
@@ -650,18 +672,18 @@ void ApiWrap::resolveMessageDatas() {
 		}).fail([this](const RPCError &error, mtpRequestId requestId) {
 			finalizeMessageDataRequest(nullptr, requestId);
 		}).afterDelay(kSmallDelayMs).send();
-		for (auto &request : _messageDataRequests) {
-			if (request.requestId > 0) continue;
-			request.requestId = requestId;
-		}
+		markRequestSent(_messageDataRequests, ids.size(), requestId);
 	}
 	for (auto j = _channelMessageDataRequests.begin(); j != _channelMessageDataRequests.cend();) {
 		if (j->isEmpty()) {
 			j = _channelMessageDataRequests.erase(j);
 			continue;
 		}
-		auto ids = collectMessageIds(j.value());
-		if (!ids.isEmpty()) {
+		while (true) {
+			auto ids = collectMessageIds(j.value());
+			if (ids.isEmpty()) {
+				break;
+			}
 			auto channel = j.key();
 			auto requestId = request(MTPchannels_GetMessages(
 				j.key()->inputChannel,
@@ -672,10 +694,7 @@ void ApiWrap::resolveMessageDatas() {
 				finalizeMessageDataRequest(channel, requestId);
 			}).afterDelay(kSmallDelayMs).send();
 
-			for (auto &request : *j) {
-				if (request.requestId > 0) continue;
-				request.requestId = requestId;
-			}
+			markRequestSent(j.value(), ids.size(), requestId);
 		}
 		++j;
 	}
@@ -2415,14 +2434,26 @@ void ApiWrap::applyAffectedMessages(
 }
 
 void ApiWrap::saveDraftsToCloud() {
-	for (auto i = _draftsSaveRequestIds.begin(), e = _draftsSaveRequestIds.end(); i != e; ++i) {
-		if (i->second) continue; // sent already
+	for (auto i = _draftsSaveRequestIds.begin(); i != _draftsSaveRequestIds.end();) {
+		if (i->second) { // sent already
+			++i;
+			continue;
+		}
 
 		auto history = i->first;
 		auto cloudDraft = history->cloudDraft();
 		auto localDraft = history->localDraft();
 		if (cloudDraft && cloudDraft->saveRequestId) {
 			request(base::take(cloudDraft->saveRequestId)).cancel();
+		} else if (!_session->supportMode()
+			&& cloudDraft
+			&& cloudDraft->date
+			&& Data::draftsAreEqual(localDraft, cloudDraft)) {
+			// The draft could get back to the already saved content
+			// while waiting for the timer, skip the identical save.
+			i = _draftsSaveRequestIds.erase(i);
+			checkQuitPreventFinished();
+			continue;
 		}
 		if (!_session->supportMode()) {
 			cloudDraft = history->createCloudDraft(localDraft);
@@ -2483,6 +2514,7 @@ void ApiWrap::saveDraftsToCloud() {
 		}).send();
 
 		i->second = cloudDraft->saveRequestId;
+		++i;
 	}
 }
 
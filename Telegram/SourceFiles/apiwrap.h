@@ -680,7 +680,7 @@ private:
 
 	MessageDataRequests _messageDataRequests;
 	QMap<ChannelData*, MessageDataRequests> _channelMessageDataRequests;
-	SingleQueuedInvokation _messageDataResolveDelayed;
+	base::Timer _messageDataResolveTimer;
 
 	using PeerRequests = QMap<PeerData*, mtpRequestId>;
 	PeerRequests _fullPeerRequests;
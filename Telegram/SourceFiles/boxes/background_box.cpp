@@ -83,6 +83,7 @@ private:
 		Data::WallPaper data;
 		mutable std::shared_ptr<Data::DocumentMedia> dataMedia;
 		mutable QPixmap thumbnail;
+		mutable bool generating = false;
 	};
 	struct Selected {
 		int index = 0;
@@ -116,6 +117,7 @@ private:
 		int column,
 		int row) const;
 	void validatePaperThumbnail(const Paper &paper) const;
+	void paperThumbnailReady(WallPaperId id, QImage &&image);
 
 	const not_null<Main::Session*> _session;
 	MTP::Sender _api;
@@ -307,7 +309,7 @@ void BackgroundBox::Inner::paintEvent(QPaintEvent *e) {
 
 void BackgroundBox::Inner::validatePaperThumbnail(
 		const Paper &paper) const {
-	if (!paper.thumbnail.isNull()) {
+	if (!paper.thumbnail.isNull() || paper.generating) {
 		return;
 	}
 	const auto localThumbnail = paper.data.localThumbnail();
@@ -325,19 +327,44 @@ void BackgroundBox::Inner::validatePaperThumbnail(
 	const auto thumbnail = localThumbnail
 		? localThumbnail
 		: paper.dataMedia->thumbnail();
-	auto original = thumbnail->original();
-	if (paper.data.isPattern()) {
-		const auto color = *paper.data.backgroundColor();
-		original = Data::PreparePatternImage(
+
+	// Pattern generation and downsampling don't fit in a frame of the
+	// box opening animation, so the cell pixmap is prepared on a worker
+	// and the cell stays empty until it arrives.
+	paper.generating = true;
+	const auto data = paper.data;
+	const auto weak = Ui::MakeWeak(const_cast<Inner*>(this));
+	crl::async([=, original = thumbnail->original()]() mutable {
+		if (data.isPattern()) {
+			const auto color = *data.backgroundColor();
+			original = Data::PreparePatternImage(
+				std::move(original),
+				color,
+				Data::PatternColor(color),
+				data.patternIntensity());
+		}
+		auto result = TakeMiddleSample(
 			std::move(original),
-			color,
-			Data::PatternColor(color),
-			paper.data.patternIntensity());
+			st::backgroundSize);
+		crl::on_main(weak, [=, image = std::move(result)]() mutable {
+			paperThumbnailReady(data.id(), std::move(image));
+		});
+	});
+}
+
+void BackgroundBox::Inner::paperThumbnailReady(
+		WallPaperId id,
+		QImage &&image) {
+	const auto i = ranges::find(_papers, id, [](const Paper &paper) {
+		return paper.data.id();
+	});
+	if (i == end(_papers)) {
+		return;
 	}
-	paper.thumbnail = App::pixmapFromImageInPlace(TakeMiddleSample(
-		original,
-		st::backgroundSize));
-	paper.thumbnail.setDevicePixelRatio(cRetinaFactor());
+	i->generating = false;
+	i->thumbnail = App::pixmapFromImageInPlace(std::move(image));
+	i->thumbnail.setDevicePixelRatio(cRetinaFactor());
+	update();
 }
 
 void BackgroundBox::Inner::paintPaper(
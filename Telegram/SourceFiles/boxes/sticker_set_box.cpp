@@ -506,7 +506,7 @@ not_null<Lottie::MultiPlayer*> StickerSetBox::Inner::getLottiePlayer() {
 	if (!_lottiePlayer) {
 		_lottiePlayer = std::make_unique<Lottie::MultiPlayer>(
 			Lottie::Quality::Default,
-			Lottie::MakeFrameRenderer());
+			Stickers::SharedLottieRenderer());
 		_lottiePlayer->updates(
 		) | rpl::start_with_next([=] {
 			update();
@@ -512,6 +512,7 @@ ApiWrap *EmojiKeywords::api() {
 }
 
 void EmojiKeywords::langPackRefreshed() {
+	_lastQuery = QString();
 	_refreshed.fire({});
 }
 
@@ -608,6 +609,8 @@ std::vector<Result> EmojiKeywords::query(
 	const auto normalized = NormalizeQuery(query);
 	if (normalized.isEmpty()) {
 		return {};
+	} else if (query == _lastQuery && exact == _lastQueryExact) {
+		return _lastQueryResult;
 	}
 	auto result = std::vector<Result>();
 	for (const auto &[language, item] : _data) {
@@ -635,6 +638,9 @@ std::vector<Result> EmojiKeywords::query(
 	if (!exact) {
 		AppendLegacySuggestions(result, query);
 	}
+	_lastQuery = query;
+	_lastQueryExact = exact;
+	_lastQueryResult = result;
 	return result;
 }
 
@@ -679,6 +685,7 @@ void EmojiKeywords::setRemoteList(std::vector<QString> &&list) {
 	if (_remoteList == list) {
 		return;
 	}
+	_lastQuery = QString();
 	_remoteList = std::move(list);
 	for (auto i = begin(_data); i != end(_data);) {
 		if (ranges::find(_remoteList, i->first) != end(_remoteList)) {
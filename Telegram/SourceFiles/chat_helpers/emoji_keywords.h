@@ -69,6 +69,12 @@ private:
 	std::deque<QStringList> _inputLanguages;
 	rpl::event_stream<> _refreshed;
 
+	// The suggestions widget queries the same text several times per
+	// keystroke, so the last lookup is kept until the data changes.
+	mutable QString _lastQuery;
+	mutable bool _lastQueryExact = false;
+	mutable std::vector<Result> _lastQueryResult;
+
 	rpl::lifetime _suggestedChangeLifetime;
 
 	rpl::lifetime _lifetime;
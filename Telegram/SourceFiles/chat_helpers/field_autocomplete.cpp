@@ -209,18 +209,6 @@ void FieldAutocomplete::updateFiltered(bool resetScroll) {
 	if (_emoji) {
 		srows = getStickerSuggestions();
 	} else if (_type == Type::Mentions) {
-		int maxListSize = _addInlineBots ? cRecentInlineBots().size() : 0;
-		if (_chat) {
-			maxListSize += (_chat->participants.empty() ? _chat->lastAuthors.size() : _chat->participants.size());
-		} else if (_channel && _channel->isMegagroup()) {
-			if (!_channel->lastParticipantsRequestNeeded()) {
-				maxListSize += _channel->mgInfo->lastParticipants.size();
-			}
-		}
-		if (maxListSize) {
-			mrows.reserve(maxListSize);
-		}
-
 		auto filterNotPassedByUsername = [this](UserData *user) -> bool {
 			if (user->username.startsWith(_filter, Qt::CaseInsensitive)) {
 				bool exactUsername = (user->username.size() == _filter.size());
@@ -238,56 +226,118 @@ void FieldAutocomplete::updateFiltered(bool resetScroll) {
 			return filterNotPassedByUsername(user);
 		};
 
-		bool listAllSuggestions = _filter.isEmpty();
-		if (_addInlineBots) {
-			for_const (auto user, cRecentInlineBots()) {
-				if (user->isInaccessible()) continue;
-				if (!listAllSuggestions && filterNotPassedByUsername(user)) continue;
-				mrows.push_back({ user });
-				++recentInlineBots;
+		// If the filter just got longer the result is a subset of the
+		// rows from the previous scan, so those can be narrowed in place
+		// instead of walking the whole participants list again. The
+		// source size check drops the shortcut when more participants
+		// arrived between the keystrokes.
+		const auto sourceSize = _chat
+			? int(_chat->participants.size() + _chat->lastAuthors.size())
+			: (_channel
+				&& _channel->isMegagroup()
+				&& !_channel->lastParticipantsRequestNeeded())
+			? int(_channel->mgInfo->lastParticipants.size())
+			: 0;
+		const auto narrowing = !_filter.isEmpty()
+			&& !_mrowsFilter.isEmpty()
+			&& _filter.size() > _mrowsFilter.size()
+			&& _filter.startsWith(_mrowsFilter, Qt::CaseInsensitive)
+			&& (_mrowsPeer == (_chat
+				? static_cast<PeerData*>(_chat)
+				: static_cast<PeerData*>(_channel)))
+			&& (_mrowsAddInlineBots == _addInlineBots)
+			&& (_mrowsSourceSize == sourceSize);
+		if (narrowing) {
+			mrows = base::take(_mrows);
+			auto to = 0;
+			for (auto from = 0; from != int(mrows.size()); ++from) {
+				const auto user = mrows[from].user;
+				const auto fromRecentBots = (from < _mrowsRecentInlineBots);
+				if (fromRecentBots
+					? filterNotPassedByUsername(user)
+					: filterNotPassedByName(user)) {
+					continue;
+				}
+				if (fromRecentBots) {
+					++recentInlineBots;
+				}
+				if (to != from) {
+					mrows[to] = std::move(mrows[from]);
+				}
+				++to;
 			}
-		}
-		if (_chat) {
-			auto sorted = base::flat_multi_map<TimeId, not_null<UserData*>>();
-			const auto byOnline = [&](not_null<UserData*> user) {
-				return Data::SortByOnlineValue(user, now);
-			};
-			mrows.reserve(mrows.size() + (_chat->participants.empty() ? _chat->lastAuthors.size() : _chat->participants.size()));
-			if (_chat->noParticipantInfo()) {
-				Auth().api().requestFullPeer(_chat);
-			} else if (!_chat->participants.empty()) {
-				for (const auto user : _chat->participants) {
-					if (user->isInaccessible()) continue;
-					if (!listAllSuggestions && filterNotPassedByName(user)) continue;
-					if (indexOfInFirstN(mrows, user, recentInlineBots) >= 0) continue;
-					sorted.emplace(byOnline(user), user);
+			mrows.resize(to);
+		} else {
+			int maxListSize = _addInlineBots ? cRecentInlineBots().size() : 0;
+			if (_chat) {
+				maxListSize += (_chat->participants.empty() ? _chat->lastAuthors.size() : _chat->participants.size());
+			} else if (_channel && _channel->isMegagroup()) {
+				if (!_channel->lastParticipantsRequestNeeded()) {
+					maxListSize += _channel->mgInfo->lastParticipants.size();
 				}
 			}
-			for (const auto user : _chat->lastAuthors) {
-				if (user->isInaccessible()) continue;
-				if (!listAllSuggestions && filterNotPassedByName(user)) continue;
-				if (indexOfInFirstN(mrows, user, recentInlineBots) >= 0) continue;
-				mrows.push_back({ user });
-				sorted.remove(byOnline(user), user);
+			if (maxListSize) {
+				mrows.reserve(maxListSize);
 			}
-			for (auto i = sorted.cend(), b = sorted.cbegin(); i != b;) {
-				--i;
-				mrows.push_back({ i->second });
+
+			bool listAllSuggestions = _filter.isEmpty();
+			if (_addInlineBots) {
+				for_const (auto user, cRecentInlineBots()) {
+					if (user->isInaccessible()) continue;
+					if (!listAllSuggestions && filterNotPassedByUsername(user)) continue;
+					mrows.push_back({ user });
+					++recentInlineBots;
+				}
 			}
-		} else if (_channel && _channel->isMegagroup()) {
-			QMultiMap<int32, UserData*> ordered;
-			if (_channel->lastParticipantsRequestNeeded()) {
-				Auth().api().requestLastParticipants(_channel);
-			} else {
-				mrows.reserve(mrows.size() + _channel->mgInfo->lastParticipants.size());
-				for (const auto user : _channel->mgInfo->lastParticipants) {
+			if (_chat) {
+				auto sorted = base::flat_multi_map<TimeId, not_null<UserData*>>();
+				const auto byOnline = [&](not_null<UserData*> user) {
+					return Data::SortByOnlineValue(user, now);
+				};
+				mrows.reserve(mrows.size() + (_chat->participants.empty() ? _chat->lastAuthors.size() : _chat->participants.size()));
+				if (_chat->noParticipantInfo()) {
+					Auth().api().requestFullPeer(_chat);
+				} else if (!_chat->participants.empty()) {
+					for (const auto user : _chat->participants) {
+						if (user->isInaccessible()) continue;
+						if (!listAllSuggestions && filterNotPassedByName(user)) continue;
+						if (indexOfInFirstN(mrows, user, recentInlineBots) >= 0) continue;
+						sorted.emplace(byOnline(user), user);
+					}
+				}
+				for (const auto user : _chat->lastAuthors) {
 					if (user->isInaccessible()) continue;
 					if (!listAllSuggestions && filterNotPassedByName(user)) continue;
 					if (indexOfInFirstN(mrows, user, recentInlineBots) >= 0) continue;
 					mrows.push_back({ user });
+					sorted.remove(byOnline(user), user);
+				}
+				for (auto i = sorted.cend(), b = sorted.cbegin(); i != b;) {
+					--i;
+					mrows.push_back({ i->second });
+				}
+			} else if (_channel && _channel->isMegagroup()) {
+				QMultiMap<int32, UserData*> ordered;
+				if (_channel->lastParticipantsRequestNeeded()) {
+					Auth().api().requestLastParticipants(_channel);
+				} else {
+					mrows.reserve(mrows.size() + _channel->mgInfo->lastParticipants.size());
+					for (const auto user : _channel->mgInfo->lastParticipants) {
+						if (user->isInaccessible()) continue;
+						if (!listAllSuggestions && filterNotPassedByName(user)) continue;
+						if (indexOfInFirstN(mrows, user, recentInlineBots) >= 0) continue;
+						mrows.push_back({ user });
+					}
 				}
 			}
 		}
+		_mrowsFilter = _filter;
+		_mrowsPeer = _chat
+			? static_cast<PeerData*>(_chat)
+			: static_cast<PeerData*>(_channel);
+		_mrowsAddInlineBots = _addInlineBots;
+		_mrowsSourceSize = sourceSize;
+		_mrowsRecentInlineBots = recentInlineBots;
 	} else if (_type == Type::Hashtags) {
 		bool listAllSuggestions = _filter.isEmpty();
 		auto &recent(cRecentWriteHashtags());
@@ -409,6 +459,9 @@ void FieldAutocomplete::rowsUpdated(
 		internal::BotCommandRows &&brows,
 		internal::StickerRows &&srows,
 		bool resetScroll) {
+	if (mrows.empty()) {
+		_mrowsFilter = QString();
+	}
 	if (mrows.empty() && hrows.empty() && brows.empty() && srows.empty()) {
 		if (!isHidden()) {
 			hideAnimated();
@@ -1010,7 +1063,7 @@ auto FieldAutocompleteInner::getLottieRenderer()
 	if (auto result = _lottieRenderer.lock()) {
 		return result;
 	}
-	auto result = Lottie::MakeFrameRenderer();
+	auto result = Stickers::SharedLottieRenderer();
 	_lottieRenderer = result;
 	return result;
 }
@@ -158,6 +158,14 @@ private:
 	};
 	Type _type = Type::Mentions;
 	QString _filter;
+
+	// Context of the last mentions scan, lets updateFiltered() narrow
+	// the existing rows when the filter only gets extended.
+	QString _mrowsFilter;
+	PeerData *_mrowsPeer = nullptr;
+	bool _mrowsAddInlineBots = false;
+	int _mrowsSourceSize = 0;
+	int _mrowsRecentInlineBots = 0;
 	QRect _boundings;
 	bool _addInlineBots;
 
@@ -1190,6 +1190,16 @@ auto LottieFromDocument(
 		Lottie::FrameRequest{ box });
 }
 
+std::shared_ptr<Lottie::FrameRenderer> SharedLottieRenderer() {
+	static auto Weak = std::weak_ptr<Lottie::FrameRenderer>();
+	if (auto result = Weak.lock()) {
+		return result;
+	}
+	auto result = Lottie::MakeFrameRenderer();
+	Weak = result;
+	return result;
+}
+
 std::unique_ptr<Lottie::SinglePlayer> LottiePlayerFromDocument(
 		not_null<Data::DocumentMedia*> media,
 		LottieSize sizeTag,
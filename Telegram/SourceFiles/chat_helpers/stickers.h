@@ -93,6 +93,11 @@ enum class LottieSize : uchar {
 	InlineResults,
 };
 
+// One rasterizer thread shared by all sticker surfaces, so frames of
+// every visible animation are pipelined through a single queue instead
+// of each panel spawning a rendering thread of its own.
+[[nodiscard]] std::shared_ptr<Lottie::FrameRenderer> SharedLottieRenderer();
+
 [[nodiscard]] std::unique_ptr<Lottie::SinglePlayer> LottiePlayerFromDocument(
 	not_null<Data::DocumentMedia*> media,
 	LottieSize sizeTag,
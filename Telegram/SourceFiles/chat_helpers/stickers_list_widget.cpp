@@ -49,6 +49,11 @@ constexpr auto kRecentDisplayLimit = 20;
 constexpr auto kPreloadOfficialPages = 4;
 constexpr auto kOfficialLoadLimit = 40;
 
+// How many sticker animations may play simultaneously, the rest of the
+// visible rows show a static frame till some budget is freed. Painting
+// goes top to bottom, so the rows furthest down degrade first.
+constexpr auto kPlayingAnimationsBudget = 24;
+
 bool SetInMyList(MTPDstickerSet::Flags flags) {
 	return (flags & MTPDstickerSet::Flag::f_installed_date)
 		&& !(flags & MTPDstickerSet::Flag::f_archived);
@@ -1486,6 +1491,8 @@ void StickersListWidget::paintEvent(QPaintEvent *e) {
 }
 
 void StickersListWidget::paintStickers(Painter &p, QRect clip) {
+	_animationsBudget = kPlayingAnimationsBudget;
+
 	auto fromColumn = floorclamp(clip.x() - stickersLeft(), _singleSize.width(), 0, _columnCount);
 	auto toColumn = ceilclamp(clip.x() + clip.width() - stickersLeft(), _singleSize.width(), 0, _columnCount);
 	if (rtl()) {
@@ -1819,7 +1826,9 @@ void StickersListWidget::paintSticker(Painter &p, Set &set, int y, int section,
 	}
 
 	const auto isAnimated = document->sticker()->animated;
+	const auto animationsAllowed = (_animationsBudget > 0);
 	if (isAnimated
+		&& animationsAllowed
 		&& !sticker.animated
 		&& media->loaded()) {
 		setupLottie(set, section, index);
@@ -1850,7 +1859,9 @@ void StickersListWidget::paintSticker(Painter &p, Set &set, int y, int section,
 		h = std::max(qRound(coef * document->dimensions.height()), 1);
 	}
 	auto ppos = pos + QPoint((_singleSize.width() - w) / 2, (_singleSize.height() - h) / 2);
-	if (sticker.animated && sticker.animated->ready()) {
+	if (sticker.animated
+		&& sticker.animated->ready()
+		&& (animationsAllowed || sticker.savedFrame.isNull())) {
 		auto request = Lottie::FrameRequest();
 		request.box = boundingBoxSize() * cIntRetinaFactor();
 		const auto frame = sticker.animated->frame(request);
@@ -1860,9 +1871,22 @@ void StickersListWidget::paintSticker(Painter &p, Set &set, int y, int section,
 		if (sticker.savedFrame.isNull()) {
 			sticker.savedFrame = QPixmap::fromImage(frame, Qt::ColorOnly);
 			sticker.savedFrame.setDevicePixelRatio(cRetinaFactor());
+			media->setLottieFirstFrame(sticker.savedFrame);
+		}
+		if (animationsAllowed) {
+			--_animationsBudget;
+			set.lottiePlayer->unpause(sticker.animated);
+		} else {
+			set.lottiePlayer->pause(sticker.animated);
 		}
-		set.lottiePlayer->unpause(sticker.animated);
 	} else {
+		if (sticker.savedFrame.isNull() && isAnimated) {
+			const auto &shared = media->lottieFirstFrame();
+			if (!shared.isNull()
+				&& shared.size() == QSize(w, h) * cIntRetinaFactor()) {
+				sticker.savedFrame = shared;
+			}
+		}
 		const auto image = media->getStickerSmall();
 		const auto pixmap = !sticker.savedFrame.isNull()
 			? sticker.savedFrame
@@ -2811,7 +2835,7 @@ auto StickersListWidget::getLottieRenderer()
 	if (auto result = _lottieRenderer.lock()) {
 		return result;
 	}
-	auto result = Lottie::MakeFrameRenderer();
+	auto result = Stickers::SharedLottieRenderer();
 	_lottieRenderer = result;
 	return result;
 }
@@ -323,6 +323,7 @@ private:
 	std::vector<bool> _custom;
 	base::flat_set<not_null<DocumentData*>> _favedStickersMap;
 	std::weak_ptr<Lottie::FrameRenderer> _lottieRenderer;
+	int _animationsBudget = 0;
 
 	mtpRequestId _officialRequestId = 0;
 	int _officialOffset = 0;
@@ -209,7 +209,11 @@ void Application::run() {
 	DEBUG_LOG(("Application Info: starting app..."));
 
 	// Create mime database, so it won't be slow later.
-	QMimeDatabase().mimeTypeForName(qsl("text/plain"));
+	// It doesn't depend on anything above and takes a while to parse
+	// the system mime types, so warm it up off the main thread.
+	crl::async([] {
+		QMimeDatabase().mimeTypeForName(qsl("text/plain"));
+	});
 
 	_window = std::make_unique<Window::Controller>(&activeAccount());
 
@@ -0,0 +1,74 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "core/paint_profiler.h"
+
+namespace Core {
+namespace {
+
+constexpr auto kReportEach = 60 * crl::time(1000);
+
+} // namespace
+
+PaintProfiler::PaintProfiler(const char *name) : _name(name) {
+}
+
+void PaintProfiler::add(crl::time duration) {
+	if (!Logs::DebugEnabled()) {
+		return;
+	}
+	const auto now = crl::now();
+	if (!_started) {
+		_started = now;
+	}
+	++_count;
+	_total += duration;
+	accumulate_max(_worst, duration);
+	const auto bucket = (duration < 4)
+		? 0
+		: (duration < 8)
+		? 1
+		: (duration < 16)
+		? 2
+		: (duration < 32)
+		? 3
+		: 4;
+	++_buckets[bucket];
+	if (now - _started >= kReportEach) {
+		report();
+	}
+}
+
+void PaintProfiler::report() {
+	DEBUG_LOG(("Paint Info: %1 painted %2 times, average %3ms, worst %4ms, "
+		"by duration <4ms: %5, <8ms: %6, <16ms: %7, <32ms: %8, slow: %9"
+		).arg(_name
+		).arg(_count
+		).arg(_count ? (_total / _count) : 0
+		).arg(_worst
+		).arg(_buckets[0]
+		).arg(_buckets[1]
+		).arg(_buckets[2]
+		).arg(_buckets[3]
+		).arg(_buckets[4]));
+	_started = _total = _worst = 0;
+	_count = 0;
+	std::fill(std::begin(_buckets), std::end(_buckets), 0);
+}
+
+PaintProfilerScope::PaintProfilerScope(PaintProfiler &profiler)
+: _profiler(profiler)
+, _started(Logs::DebugEnabled() ? crl::now() : 0) {
+}
+
+PaintProfilerScope::~PaintProfilerScope() {
+	if (_started) {
+		_profiler.add(crl::now() - _started);
+	}
+}
+
+} // namespace Core
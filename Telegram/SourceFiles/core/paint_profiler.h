@@ -0,0 +1,45 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+namespace Core {
+
+// Accumulates durations of one hot code path, normally a paint event,
+// and periodically writes a histogram summary to the debug log, so
+// "everything feels slow" reports can be compared between builds.
+// Does nothing unless debug logs are enabled.
+class PaintProfiler {
+public:
+	explicit PaintProfiler(const char *name);
+
+	void add(crl::time duration);
+
+private:
+	void report();
+
+	const char *_name = nullptr;
+	crl::time _started = 0;
+	crl::time _total = 0;
+	crl::time _worst = 0;
+	int _count = 0;
+	int _buckets[5] = { 0 }; // < 4 / 8 / 16 / 32 ms and the rest.
+
+};
+
+class PaintProfilerScope {
+public:
+	explicit PaintProfilerScope(PaintProfiler &profiler);
+	~PaintProfilerScope();
+
+private:
+	PaintProfiler &_profiler;
+	crl::time _started = 0;
+
+};
+
+} // namespace Core
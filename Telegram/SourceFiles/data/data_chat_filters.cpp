@@ -363,29 +363,7 @@ bool ChatFilters::applyChange(ChatFilter &filter, ChatFilter &&updated) {
 		return false;
 	}
 	if (rulesChanged) {
-		const auto filterList = _owner->chatsFilters().chatsList(id);
-		const auto feedHistory = [&](not_null<History*> history) {
-			const auto now = updated.contains(history);
-			const auto was = filter.contains(history);
-			if (now != was) {
-				if (now) {
-					history->addToChatList(id, filterList);
-				} else {
-					history->removeFromChatList(id, filterList);
-				}
-			}
-		};
-		const auto feedList = [&](not_null<const Dialogs::MainList*> list) {
-			for (const auto &entry : *list->indexed()) {
-				if (const auto history = entry->history()) {
-					feedHistory(history);
-				}
-			}
-		};
-		feedList(_owner->chatsList());
-		if (const auto folder = _owner->folderLoaded(Data::Folder::kId)) {
-			feedList(folder->chatsList());
-		}
+		scheduleRecount(updated);
 		if (exceptionsChanged && !updated.always().empty()) {
 			_exceptionsToLoad.push_back(id);
 			Ui::PostponeCall(&_owner->session(), [=] {
@@ -558,6 +536,70 @@ bool ChatFilters::loadNextExceptions(bool chatsListLoaded) {
 	return true;
 }
 
+void ChatFilters::scheduleRecount(ChatFilter filter) {
+	// Membership is re-evaluated in time-sliced batches so a filter
+	// edit on a huge account doesn't lock the UI for the full pass.
+	// A newer change to the same filter simply replaces the pending
+	// recount with a fresh snapshot and the new rules: already
+	// processed histories self-heal because each step compares the
+	// target membership against the actual inChatList() state.
+	const auto id = filter.id();
+	auto &recount = _recounts[id];
+	recount.filter = std::move(filter);
+	recount.histories.clear();
+	recount.index = 0;
+	const auto append = [&](not_null<const Dialogs::MainList*> list) {
+		for (const auto &entry : *list->indexed()) {
+			if (const auto history = entry->history()) {
+				recount.histories.push_back(history);
+			}
+		}
+	};
+	append(_owner->chatsList());
+	if (const auto folder = _owner->folderLoaded(Data::Folder::kId)) {
+		append(folder->chatsList());
+	}
+	if (!_recountScheduled) {
+		_recountScheduled = true;
+		crl::on_main(&_owner->session(), [=] { processRecounts(); });
+	}
+}
+
+void ChatFilters::processRecounts() {
+	constexpr auto kSliceDuration = crl::time(8);
+	constexpr auto kCheckTimeEvery = 64;
+
+	_recountScheduled = false;
+	const auto deadline = crl::now() + kSliceDuration;
+	while (!_recounts.empty()) {
+		const auto i = begin(_recounts);
+		const auto id = i->first;
+		const auto filterList = chatsList(id);
+		auto &recount = i->second;
+		while (recount.index < int(recount.histories.size())) {
+			const auto history = recount.histories[recount.index++];
+			const auto now = recount.filter.contains(history);
+			const auto was = history->inChatList(id);
+			if (now != was) {
+				if (now) {
+					history->addToChatList(id, filterList);
+				} else {
+					history->removeFromChatList(id, filterList);
+				}
+			}
+			if (!(recount.index % kCheckTimeEvery)
+				&& crl::now() >= deadline) {
+				_recountScheduled = true;
+				crl::on_main(&_owner->session(), [=] {
+					processRecounts();
+				});
+				return;
+			}
+		}
+		_recounts.erase(i);
+	}
+}
+
 void ChatFilters::refreshHistory(not_null<History*> history) {
 	_refreshHistoryRequests.fire_copy(history);
 }
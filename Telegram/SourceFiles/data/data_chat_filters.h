@@ -126,11 +126,19 @@ public:
 	[[nodiscard]] rpl::producer<> suggestedUpdated() const;
 
 private:
+	struct Recount {
+		ChatFilter filter;
+		std::vector<not_null<History*>> histories;
+		int index = 0;
+	};
+
 	void load(bool force);
 	bool applyOrder(const QVector<MTPint> &order);
 	bool applyChange(ChatFilter &filter, ChatFilter &&updated);
 	void applyInsert(ChatFilter filter, int position);
 	void applyRemove(int position);
+	void scheduleRecount(ChatFilter filter);
+	void processRecounts();
 
 	const not_null<Session*> _owner;
 
@@ -151,6 +159,9 @@ private:
 	std::deque<FilterId> _exceptionsToLoad;
 	mtpRequestId _exceptionsLoadRequestId = 0;
 
+	base::flat_map<FilterId, Recount> _recounts;
+	bool _recountScheduled = false;
+
 };
 
 } // namespace Data
@@ -298,6 +298,7 @@ void DocumentMedia::collectLocalData(not_null<DocumentMedia*> local) {
 	if (const auto image = local->_sticker.get()) {
 		_sticker = std::make_unique<Image>(image->original());
 	}
+	_lottieFirstFrame = local->_lottieFirstFrame;
 	_bytes = local->_bytes;
 	_videoThumbnailBytes = local->_videoThumbnailBytes;
 	_flags = local->_flags;
@@ -364,6 +365,16 @@ Image *DocumentMedia::getStickerSmall() {
 	return _sticker.get();
 }
 
+void DocumentMedia::setLottieFirstFrame(QPixmap frame) {
+	if (_lottieFirstFrame.isNull()) {
+		_lottieFirstFrame = std::move(frame);
+	}
+}
+
+const QPixmap &DocumentMedia::lottieFirstFrame() const {
+	return _lottieFirstFrame;
+}
+
 void DocumentMedia::checkStickerLarge(not_null<FileLoader*> loader) {
 	if (_sticker || !_owner->sticker()) {
 		return;
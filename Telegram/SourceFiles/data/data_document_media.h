@@ -69,6 +69,12 @@ public:
 	[[nodiscard]] Image *getStickerLarge();
 	void checkStickerLarge(not_null<FileLoader*> loader);
 
+	// First rendered frame of an animated sticker, shared by all the
+	// surfaces showing this document, so a reappearing sticker paints
+	// instantly while its animation spins up.
+	void setLottieFirstFrame(QPixmap frame);
+	[[nodiscard]] const QPixmap &lottieFirstFrame() const;
+
 	void setBytes(const QByteArray &bytes);
 	[[nodiscard]] QByteArray bytes() const;
 	[[nodiscard]] bool loaded(bool check = false) const;
@@ -104,6 +110,7 @@ private:
 	mutable std::unique_ptr<Image> _inlineThumbnail;
 	std::unique_ptr<Image> _thumbnail;
 	std::unique_ptr<Image> _sticker;
+	QPixmap _lottieFirstFrame;
 	QByteArray _bytes;
 	QByteArray _videoThumbnailBytes;
 	Flags _flags;
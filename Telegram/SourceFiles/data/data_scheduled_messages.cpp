@@ -199,8 +199,14 @@ void ScheduledMessages::apply(const MTPDupdateNewScheduledMessage &update) {
 		return;
 	}
 	auto &list = _data[history];
+	const auto wasCount = int(list.items.size());
 	append(history, list, message);
-	sort(list);
+	if (int(list.items.size()) > wasCount) {
+		sortLast(list);
+	} else {
+		// An existing item could get another date, place is unknown.
+		sort(list);
+	}
 	_updates.fire_copy(history);
 }
 
@@ -297,7 +303,7 @@ void ScheduledMessages::appendSending(not_null<HistoryItem*> item) {
 	const auto history = item->history();
 	auto &list = _data[history];
 	list.items.emplace_back(item);
-	sort(list);
+	sortLast(list);
 	_updates.fire_copy(history);
 }
 
@@ -470,6 +476,21 @@ void ScheduledMessages::sort(List &list) {
 	ranges::sort(list.items, ranges::less(), &HistoryItem::position);
 }
 
+void ScheduledMessages::sortLast(List &list) {
+	Expects(!list.items.empty());
+
+	// The list is already sorted, so the single appended item is just
+	// moved to its place instead of re-sorting thousands of items.
+	const auto from = list.items.end() - 1;
+	const auto to = ranges::upper_bound(
+		begin(list.items),
+		from,
+		(*from)->position(),
+		ranges::less(),
+		&HistoryItem::position);
+	std::rotate(to, from, list.items.end());
+}
+
 void ScheduledMessages::remove(not_null<const HistoryItem*> item) {
 	const auto history = item->history();
 	const auto i = _data.find(history);
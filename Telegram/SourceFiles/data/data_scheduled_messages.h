@@ -77,6 +77,7 @@ private:
 		const base::flat_set<not_null<HistoryItem*>> &added,
 		const base::flat_set<not_null<HistoryItem*>> &clear);
 	void sort(List &list);
+	void sortLast(List &list);
 	void remove(not_null<const HistoryItem*> item);
 	[[nodiscard]] int32 countListHash(const List &list) const;
 	void clearOldRequests();
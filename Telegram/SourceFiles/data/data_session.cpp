@@ -62,6 +62,9 @@ namespace {
 
 constexpr auto kMaxNotifyCheckDelay = 24 * 3600 * crl::time(1000);
 constexpr auto kMaxWallpaperSize = 10 * 1024 * 1024;
+constexpr auto kChatPreloadDelay = 3 * crl::time(1000);
+constexpr auto kChatPreloadCount = 4;
+constexpr auto kChatPreloadMessages = 30;
 
 using ViewElement = HistoryView::Element;
 
@@ -211,6 +214,7 @@ Session::Session(not_null<Main::Session*> session)
 , _contactsList(Dialogs::SortMode::Name)
 , _contactsNoChatsList(Dialogs::SortMode::Name)
 , _selfDestructTimer([=] { checkSelfDestructItems(); })
+, _preloadLikelyTimer([=] { preloadLikelyChats(); })
 , _sendActionsAnimation([=](crl::time now) {
 	return sendActionsAnimationCallback(now);
 })
@@ -267,6 +271,26 @@ void Session::clear() {
 	_photos.clear();
 }
 
+void Session::dumpCacheStats() const {
+	auto channelMessages = size_t(0);
+	for (const auto &[channelId, messages] : _channelMessages) {
+		channelMessages += messages.size();
+	}
+	LOG(("Data Stats: peers: %1, messages: %2, channel messages: %3, "
+		"views: %4, photos: %5, documents: %6, webpages: %7, polls: %8, "
+		"games: %9, locations: %10"
+		).arg(_peers.size()
+		).arg(_messages.size()
+		).arg(channelMessages
+		).arg(_views.size()
+		).arg(_photos.size()
+		).arg(_documents.size()
+		).arg(_webpages.size()
+		).arg(_polls.size()
+		).arg(_games.size()
+		).arg(_locations.size()));
+}
+
 void Session::keepAlive(std::shared_ptr<PhotoMedia> media) {
 	// NB! This allows PhotoMedia to outlive Main::Session!
 	// In case this is a problem this code should be rewritten.
@@ -2165,6 +2189,81 @@ void Session::checkSelfDestructItems() {
 	}
 }
 
+void Session::registerChatOpen(not_null<PeerData*> peer) {
+	auto &counter = _chatOpens[peer];
+	++counter.count;
+	counter.lastOpen = crl::now();
+	_preloadLikelyTimer.callOnce(kChatPreloadDelay);
+}
+
+void Session::preloadLikelyChats() {
+	auto ranked = std::vector<std::pair<not_null<PeerData*>, ChatOpenCounter>>();
+	ranked.reserve(_chatOpens.size());
+	for (const auto &[peer, counter] : _chatOpens) {
+		ranked.push_back({ peer, counter });
+	}
+	ranges::sort(ranked, std::greater<>(), [](const auto &entry) {
+		return std::make_pair(entry.second.count, entry.second.lastOpen);
+	});
+	auto requested = 0;
+	for (const auto &[peer, counter] : ranked) {
+		if (requested == kChatPreloadCount) {
+			break;
+		}
+		const auto history = this->history(peer);
+		if (!history->isEmpty() || _preloadedChats.contains(history)) {
+			continue;
+		}
+		_preloadedChats.emplace(history);
+		preloadChatMessages(history);
+		++requested;
+	}
+}
+
+void Session::preloadChatMessages(not_null<History*> history) {
+	const auto type = Histories::RequestType::History;
+	histories().sendRequest(history, type, [=](Fn<void()> finish) {
+		return session().api().request(MTPmessages_GetHistory(
+			history->peer->input,
+			MTP_int(0), // offset_id
+			MTP_int(0), // offset_date
+			MTP_int(0), // add_offset
+			MTP_int(kChatPreloadMessages),
+			MTP_int(0), // max_id
+			MTP_int(0), // min_id
+			MTP_int(0)  // hash
+		)).done([=](const MTPmessages_Messages &result) {
+			applyPreloadedMessages(history, result);
+			finish();
+		}).fail([=](const RPCError &error) {
+			finish();
+		}).send();
+	});
+}
+
+void Session::applyPreloadedMessages(
+		not_null<History*> history,
+		const MTPmessages_Messages &result) {
+	result.match([&](const MTPDmessages_messagesNotModified &data) {
+		LOG(("API Error: received messages.messagesNotModified! "
+			"(Session::applyPreloadedMessages)"));
+	}, [&](const auto &data) {
+		if constexpr (MTPDmessages_channelMessages::Is<decltype(data)>()) {
+			if (const auto channel = history->peer->asChannel()) {
+				channel->ptsReceived(data.vpts().v);
+			}
+		}
+		processUsers(data.vusers());
+		processChats(data.vchats());
+		if (!history->isEmpty()) {
+			// Got opened while the preload was in flight.
+			return;
+		}
+		history->getReadyFor(ShowAtTheEndMsgId);
+		history->addOlderSlice(data.vmessages().v);
+	});
+}
+
 not_null<PhotoData*> Session::photo(PhotoId id) {
 	auto i = _photos.find(id);
 	if (i == _photos.end()) {
@@ -2935,7 +3034,7 @@ not_null<PollData*> Session::processPoll(const MTPDmessageMediaPoll &data) {
 	const auto result = processPoll(data.vpoll());
 	const auto changed = result->applyResults(data.vresults());
 	if (changed) {
-		notifyPollUpdateDelayed(result);
+		notifyPollResultsDelayed(result);
 	}
 	return result;
 }
@@ -2974,7 +3073,7 @@ void Session::applyUpdate(const MTPDupdateMessagePoll &update) {
 			: i->second.get();
 	}();
 	if (updated && updated->applyResults(update.vresults())) {
-		notifyPollUpdateDelayed(updated);
+		notifyPollResultsDelayed(updated);
 	}
 }
 
@@ -3274,7 +3373,8 @@ QString Session::findContactPhone(UserId contactId) const {
 bool Session::hasPendingWebPageGamePollNotification() const {
 	return !_webpagesUpdated.empty()
 		|| !_gamesUpdated.empty()
-		|| !_pollsUpdated.empty();
+		|| !_pollsUpdated.empty()
+		|| !_pollResultsUpdated.empty();
 }
 
 void Session::notifyWebPageUpdateDelayed(not_null<WebPageData*> page) {
@@ -3301,6 +3401,14 @@ void Session::notifyPollUpdateDelayed(not_null<PollData*> poll) {
 	}
 }
 
+void Session::notifyPollResultsDelayed(not_null<PollData*> poll) {
+	const auto invoke = !hasPendingWebPageGamePollNotification();
+	_pollResultsUpdated.insert(poll);
+	if (invoke) {
+		crl::on_main(_session, [=] { sendWebPageGamePollNotifications(); });
+	}
+}
+
 void Session::sendWebPageGamePollNotifications() {
 	for (const auto page : base::take(_webpagesUpdated)) {
 		const auto i = _webpageViews.find(page);
@@ -3318,12 +3426,25 @@ void Session::sendWebPageGamePollNotifications() {
 		}
 	}
 	for (const auto poll : base::take(_pollsUpdated)) {
+		_pollResultsUpdated.remove(poll);
 		if (const auto i = _pollViews.find(poll); i != _pollViews.end()) {
 			for (const auto view : i->second) {
 				requestViewResize(view);
 			}
 		}
 	}
+	// Vote counts don't change the bubble geometry, so results-only
+	// updates refresh the media in place without a history relayout.
+	for (const auto poll : base::take(_pollResultsUpdated)) {
+		if (const auto i = _pollViews.find(poll); i != _pollViews.end()) {
+			for (const auto view : i->second) {
+				if (const auto media = view->media()) {
+					media->updatePollResults();
+				}
+				requestViewRepaint(view);
+			}
+		}
+	}
 }
 
 void Session::registerItemView(not_null<ViewElement*> view) {
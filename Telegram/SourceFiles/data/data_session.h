@@ -110,8 +110,16 @@ public:
 		return ++_nonHistoryEntryId;
 	}
 
+	// Tracks how often chats are opened and preloads the recent messages
+	// of the most frequent ones shortly after, while the app is idle.
+	void registerChatOpen(not_null<PeerData*> peer);
+
 	void clear();
 
+	// Writes the sizes of the main object registries to the log,
+	// triggered by the "cachestats" settings code.
+	void dumpCacheStats() const;
+
 	void keepAlive(std::shared_ptr<PhotoMedia> media);
 	void keepAlive(std::shared_ptr<DocumentMedia> media);
 
@@ -622,6 +630,7 @@ public:
 	void notifyWebPageUpdateDelayed(not_null<WebPageData*> page);
 	void notifyGameUpdateDelayed(not_null<GameData*> game);
 	void notifyPollUpdateDelayed(not_null<PollData*> poll);
+	void notifyPollResultsDelayed(not_null<PollData*> poll);
 	bool hasPendingWebPageGamePollNotification() const;
 	void sendWebPageGamePollNotifications();
 
@@ -714,6 +723,12 @@ private:
 
 	void checkSelfDestructItems();
 
+	void preloadLikelyChats();
+	void preloadChatMessages(not_null<History*> history);
+	void applyPreloadedMessages(
+		not_null<History*> history,
+		const MTPmessages_Messages &result);
+
 	int computeUnreadBadge(const Dialogs::UnreadState &state) const;
 	bool computeUnreadBadgeMuted(const Dialogs::UnreadState &state) const;
 
@@ -909,6 +924,14 @@ private:
 	base::Timer _selfDestructTimer;
 	std::vector<FullMsgId> _selfDestructItems;
 
+	struct ChatOpenCounter {
+		int count = 0;
+		crl::time lastOpen = 0;
+	};
+	base::flat_map<not_null<PeerData*>, ChatOpenCounter> _chatOpens;
+	base::flat_set<not_null<History*>> _preloadedChats;
+	base::Timer _preloadLikelyTimer;
+
 	// When typing in this history started.
 	base::flat_map<not_null<History*>, crl::time> _sendActions;
 	Ui::Animations::Basic _sendActionsAnimation;
@@ -959,6 +982,7 @@ private:
 	base::flat_set<not_null<WebPageData*>> _webpagesUpdated;
 	base::flat_set<not_null<GameData*>> _gamesUpdated;
 	base::flat_set<not_null<PollData*>> _pollsUpdated;
+	base::flat_set<not_null<PollData*>> _pollResultsUpdated;
 
 	base::flat_multi_map<TimeId, not_null<PollData*>> _pollsClosings;
 	base::Timer _pollsClosingTimer;
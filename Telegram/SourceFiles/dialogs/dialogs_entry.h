@@ -32,6 +32,16 @@ struct RowsByLetter {
 	base::flat_map<QChar, not_null<Row*>> letters;
 };
 
+// Cached rendering of the last message preview text of a chats list
+// row, shared by all rows of the same entry. Reset together with
+// textCachedFor and when the painted colors change.
+struct RowTextCache {
+	QPixmap pixmap;
+	QColor fg;
+	QColor linkFg;
+	int state = -1;
+};
+
 enum class SortMode {
 	Date    = 0x00,
 	Name    = 0x01,
@@ -179,6 +189,7 @@ public:
 
 	mutable const HistoryItem *textCachedFor = nullptr; // cache
 	mutable Ui::Text::String lastItemTextCache;
+	mutable RowTextCache lastItemTextPixmap;
 
 protected:
 	void notifyUnreadStateChange(const UnreadState &wasState);
@@ -33,6 +33,7 @@ RowsByLetter IndexedList::addToEnd(Key key) {
 		}
 		result.letters.emplace(ch, j->second.addToEnd(key));
 	}
+	updatePrefixIndex(key);
 	return result;
 }
 
@@ -49,6 +50,7 @@ Row *IndexedList::addByName(Key key) {
 		}
 		j->second.addByName(key);
 	}
+	updatePrefixIndex(key);
 	return result;
 }
 
@@ -146,6 +148,7 @@ void IndexedList::adjustByName(
 			j->second.addByName(key);
 		}
 	}
+	updatePrefixIndex(key);
 }
 
 void IndexedList::adjustNames(
@@ -184,6 +187,7 @@ void IndexedList::adjustNames(
 			history->addChatListEntryByLetter(filterId, ch, row);
 		}
 	}
+	updatePrefixIndex(key);
 }
 
 void IndexedList::del(Key key, Row *replacedBy) {
@@ -193,39 +197,98 @@ void IndexedList::del(Key key, Row *replacedBy) {
 				it->second.del(key, replacedBy);
 			}
 		}
+		removeFromPrefixIndex(key);
 	}
 }
 
 void IndexedList::clear() {
 	_index.clear();
+	_prefixIndex.clear();
+	_prefixWordsByKey.clear();
 }
 
-std::vector<not_null<Row*>> IndexedList::filtered(
-		const QStringList &words) const {
-	const auto minimal = [&]() -> const Dialogs::List* {
-		if (empty()) {
-			return nullptr;
-		}
-		auto result = (const Dialogs::List*)nullptr;
-		for (const auto &word : words) {
-			if (word.isEmpty()) {
-				continue;
-			}
-			const auto found = filtered(word[0]);
-			if (!found || found->empty()) {
-				return nullptr;
-			} else if (!result || result->size() > found->size()) {
-				result = found;
+void IndexedList::updatePrefixIndex(Key key) {
+	removeFromPrefixIndex(key);
+
+	const auto &nameWords = key.entry()->chatListNameWords();
+	auto &stored = _prefixWordsByKey[key];
+	stored.reserve(nameWords.size());
+	for (const auto &word : nameWords) {
+		stored.push_back(word);
+		_prefixIndex.emplace(word, key);
+	}
+}
+
+void IndexedList::removeFromPrefixIndex(Key key) {
+	const auto i = _prefixWordsByKey.find(key);
+	if (i == _prefixWordsByKey.end()) {
+		return;
+	}
+	for (const auto &word : i->second) {
+		const auto [from, till] = _prefixIndex.equal_range(word);
+		for (auto j = from; j != till; ++j) {
+			if (j->second == key) {
+				_prefixIndex.erase(j);
+				break;
 			}
 		}
-		return result;
-	}();
+	}
+	_prefixWordsByKey.erase(i);
+}
+
+std::vector<not_null<Row*>> IndexedList::filtered(
+		const QStringList &words) const {
 	auto result = std::vector<not_null<Row*>>();
-	if (!minimal || minimal->empty()) {
+	if (empty()) {
+		return result;
+	}
+
+	// Resolve each query word to its range in the prefix index and use
+	// the narrowest one as the candidate set, so a keystroke touches
+	// only rows whose name actually starts with the typed prefix
+	// instead of a whole first-letter bucket.
+	using Range = std::pair<
+		std::multimap<QString, Key>::const_iterator,
+		std::multimap<QString, Key>::const_iterator>;
+	const auto rangeFor = [&](const QString &word) -> Range {
+		const auto from = _prefixIndex.lower_bound(word);
+		const auto last = word.at(word.size() - 1);
+		if (last.unicode() == 0xFFFF) {
+			return { from, _prefixIndex.end() };
+		}
+		auto upper = word;
+		upper[upper.size() - 1] = QChar(last.unicode() + 1);
+		return { from, _prefixIndex.lower_bound(upper) };
+	};
+	auto minimal = Range();
+	auto minimalSize = -1;
+	for (const auto &word : words) {
+		if (word.isEmpty()) {
+			continue;
+		}
+		const auto range = rangeFor(word);
+		const auto size = int(std::distance(range.first, range.second));
+		if (!size) {
+			return result;
+		} else if (minimalSize < 0 || size < minimalSize) {
+			minimal = range;
+			minimalSize = size;
+		}
+	}
+	if (minimalSize <= 0) {
 		return result;
 	}
-	result.reserve(minimal->size());
-	for (const auto row : *minimal) {
+	result.reserve(minimalSize);
+	auto seen = base::flat_set<Key>();
+	seen.reserve(minimalSize);
+	for (auto i = minimal.first; i != minimal.second; ++i) {
+		if (!seen.emplace(i->second).second) {
+			continue;
+		}
+		const auto row = _list.getRow(i->second);
+		if (!row) {
+			continue;
+		}
 		const auto &nameWords = row->entry()->chatListNameWords();
 		const auto found = [&](const QString &word) {
 			for (const auto &name : nameWords) {
@@ -247,6 +310,10 @@ std::vector<not_null<Row*>> IndexedList::filtered(
 			result.push_back(row);
 		}
 	}
+
+	// Candidates come out in name order, the callers expect the same
+	// order as the underlying list (date / position order).
+	ranges::sort(result, ranges::less(), &Row::pos);
 	return result;
 }
 
@@ -80,11 +80,20 @@ private:
 		not_null<History*> history,
 		const base::flat_set<QChar> &oldChars);
 
+	void updatePrefixIndex(Key key);
+	void removeFromPrefixIndex(Key key);
+
 	SortMode _sortMode = SortMode();
 	FilterId _filterId = 0;
 	List _list, _empty;
 	base::flat_map<QChar, List> _index;
 
+	// Name-word prefix index: each chat list name word maps to its key,
+	// so a search query word resolves to a lower/upper bound range of
+	// candidates in O(log n) instead of a scan of a letter bucket.
+	std::multimap<QString, Key> _prefixIndex;
+	base::flat_map<Key, std::vector<QString>> _prefixWordsByKey;
+
 };
 
 } // namespace Dialogs
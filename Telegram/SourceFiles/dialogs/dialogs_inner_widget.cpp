@@ -14,6 +14,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 //#include "history/feed/history_feed_section.h" // #feed
 #include "history/history.h"
 #include "history/history_item.h"
+#include "core/paint_profiler.h"
 #include "core/shortcuts.h"
 #include "ui/widgets/buttons.h"
 #include "ui/widgets/popup_menu.h"
@@ -234,11 +235,13 @@ InnerWidget::InnerWidget(
 		if (update.flags & UpdateFlag::ChatPinnedChanged) {
 			stopReorderPinned();
 		}
-		if (update.flags & UpdateFlag::NameChanged) {
-			this->update();
+		if (update.flags
+			& (UpdateFlag::NameChanged
+				| UpdateFlag::PhotoChanged
+				| UpdateFlag::UserOccupiedChanged)) {
+			updateDialogRowsByPeer(update.peer);
 		}
 		if (update.flags & (UpdateFlag::PhotoChanged | UpdateFlag::UserOccupiedChanged)) {
-			this->update();
 			emit App::main()->dialogsUpdated();
 		}
 		if (update.flags & UpdateFlag::UserIsContact) {
@@ -397,6 +400,9 @@ void InnerWidget::changeOpenedFolder(Data::Folder *folder) {
 }
 
 void InnerWidget::paintEvent(QPaintEvent *e) {
+	static auto profiler = Core::PaintProfiler("DialogsInner");
+	const auto scope = Core::PaintProfilerScope(profiler);
+
 	Painter p(this);
 
 	const auto r = e->rect();
@@ -1562,6 +1568,27 @@ void InnerWidget::refreshDialogRow(RowDescriptor row) {
 	repaintDialogRow(row);
 }
 
+void InnerWidget::updateDialogRowsByPeer(not_null<PeerData*> peer) {
+	// A change in a single peer (name, photo, occupation) repaints
+	// only the rows of that peer instead of the whole visible list.
+	if (const auto history = peer->owner().historyLoaded(peer)) {
+		updateDialogRow(RowDescriptor(history, FullMsgId()));
+	}
+	if (_state == WidgetState::Filtered) {
+		updateSearchResult(peer);
+		if (!_searchResults.empty()) {
+			const auto add = searchedOffset();
+			auto index = 0;
+			for (const auto &result : _searchResults) {
+				if (result->item()->history()->peer == peer) {
+					rtlupdate(0, add + index * st::dialogsRowHeight, width(), st::dialogsRowHeight);
+				}
+				++index;
+			}
+		}
+	}
+}
+
 void InnerWidget::updateSearchResult(not_null<PeerData*> peer) {
 	if (_state == WidgetState::Filtered) {
 		if (!_peerSearchResults.empty()) {
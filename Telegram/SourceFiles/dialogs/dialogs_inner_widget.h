@@ -254,6 +254,7 @@ private:
 	using UpdateRowSections = base::flags<UpdateRowSection>;
 	friend inline constexpr auto is_flag_type(UpdateRowSection) { return true; };
 
+	void updateDialogRowsByPeer(not_null<PeerData*> peer);
 	void updateSearchResult(not_null<PeerData*> peer);
 	void updateDialogRow(
 		RowDescriptor row,
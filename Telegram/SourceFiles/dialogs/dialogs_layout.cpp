@@ -752,7 +752,8 @@ void RowPainter::paint(
 				selected,
 				HistoryItem::DrawInDialog::Normal,
 				entry->textCachedFor,
-				entry->lastItemTextCache);
+				entry->lastItemTextCache,
+				entry->lastItemTextPixmap);
 		}
 	};
 	const auto paintCounterCallback = [&] {
@@ -870,7 +871,8 @@ void RowPainter::paint(
 			selected,
 			drawInDialogWay,
 			row->_cacheFor,
-			row->_cache);
+			row->_cache,
+			row->_pixmapCache);
 	};
 	const auto paintCounterCallback = [&] {
 		PaintNarrowCounter(
@@ -120,6 +120,7 @@ void MainList::unreadStateChanged(
 		_cloudUnreadState += nowState - wasState;
 		finalizeCloudUnread();
 	}
+	checkUnreadStateConsistency();
 }
 
 void MainList::unreadEntryChanged(
@@ -144,6 +145,7 @@ void MainList::unreadEntryChanged(
 		}
 		finalizeCloudUnread();
 	}
+	checkUnreadStateConsistency();
 }
 
 void MainList::updateCloudUnread(const MTPDdialogFolder &data) {
@@ -171,6 +173,43 @@ void MainList::finalizeCloudUnread() {
 	_cloudUnreadState.marksMuted = _cloudUnreadState.marks = 0;
 }
 
+void MainList::checkUnreadStateConsistency() const {
+	// The aggregate state is maintained by applying signed deltas, so one
+	// entry reporting a wrong delta would corrupt the counters silently.
+	// With debug logs enabled recompute the sum from the entries and
+	// report any divergence.
+	if (!Logs::DebugEnabled()) {
+		return;
+	}
+	auto computed = UnreadState();
+	for (const auto row : _all) {
+		computed += row->entry()->chatListUnreadState();
+	}
+	if (computed.messages != _unreadState.messages
+		|| computed.messagesMuted != _unreadState.messagesMuted
+		|| computed.chats != _unreadState.chats
+		|| computed.chatsMuted != _unreadState.chatsMuted
+		|| computed.marks != _unreadState.marks
+		|| computed.marksMuted != _unreadState.marksMuted) {
+		LOG(("Unread State Error: Mismatch in list %1, "
+			"accumulated %2 / %3 messages, %4 / %5 chats, %6 / %7 marks, "
+			"computed %8 / %9 messages, %10 / %11 chats, %12 / %13 marks."
+			).arg(_filterId
+			).arg(_unreadState.messages
+			).arg(_unreadState.messagesMuted
+			).arg(_unreadState.chats
+			).arg(_unreadState.chatsMuted
+			).arg(_unreadState.marks
+			).arg(_unreadState.marksMuted
+			).arg(computed.messages
+			).arg(computed.messagesMuted
+			).arg(computed.chats
+			).arg(computed.chatsMuted
+			).arg(computed.marks
+			).arg(computed.marksMuted));
+	}
+}
+
 UnreadState MainList::unreadState() const {
 	const auto useCloudState = _cloudUnreadState.known && !loaded();
 	auto result = useCloudState ? _cloudUnreadState : _unreadState;
@@ -47,6 +47,7 @@ public:
 private:
 	void finalizeCloudUnread();
 	void recomputeFullListSize();
+	void checkUnreadStateConsistency() const;
 
 	auto unreadStateChangeNotifier(bool notify) {
 		const auto wasState = notify ? unreadState() : UnreadState();
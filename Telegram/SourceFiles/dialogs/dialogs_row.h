@@ -9,6 +9,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 #include "ui/text/text.h"
 #include "ui/effects/animations.h"
+#include "dialogs/dialogs_entry.h"
 #include "dialogs/dialogs_key.h"
 
 class History;
@@ -134,6 +135,7 @@ public:
 	void invalidateCache() {
 		_cacheFor = nullptr;
 		_cache = Ui::Text::String();
+		_pixmapCache = RowTextCache();
 	}
 
 private:
@@ -143,6 +145,7 @@ private:
 	not_null<HistoryItem*> _item;
 	mutable const HistoryItem *_cacheFor = nullptr;
 	mutable Ui::Text::String _cache;
+	mutable RowTextCache _pixmapCache;
 
 };
 
@@ -236,6 +236,11 @@ struct ApiWrap::ChatProcess {
 	std::optional<Data::MessagesSlice> slice;
 	bool lastSlice = false;
 	int fileIndex = 0;
+
+	std::optional<Data::MessagesSlice> prefetched;
+	bool prefetchRequested = false;
+	bool prefetchLastSlice = false;
+	bool sliceWanted = false;
 };
 
 
@@ -1352,6 +1357,16 @@ void ApiWrap::appendChatsSlice(
 void ApiWrap::requestMessagesSlice() {
 	Expects(_chatProcess != nullptr);
 
+	if (_chatProcess->prefetched) {
+		if (base::take(_chatProcess->prefetchLastSlice)) {
+			_chatProcess->lastSlice = true;
+		}
+		loadMessagesFiles(*base::take(_chatProcess->prefetched));
+		return;
+	} else if (_chatProcess->prefetchRequested) {
+		_chatProcess->sliceWanted = true;
+		return;
+	}
 	const auto count = _chatProcess->info.messagesCountPerSplit[
 		_chatProcess->localSplitIndex];
 	if (!count) {
@@ -1463,9 +1478,52 @@ void ApiWrap::loadMessagesFiles(Data::MessagesSlice &&slice) {
 	_chatProcess->slice = std::move(slice);
 	_chatProcess->fileIndex = 0;
 
+	if (!_chatProcess->lastSlice) {
+		prefetchMessagesSlice();
+	}
 	loadNextMessageFile();
 }
 
+void ApiWrap::prefetchMessagesSlice() {
+	Expects(_chatProcess != nullptr);
+	Expects(_chatProcess->slice.has_value());
+	Expects(!_chatProcess->prefetchRequested);
+
+	// Request the next messages slice right away, so that the round-trip
+	// happens while the media files of the current slice are downloading.
+	const auto &list = _chatProcess->slice->list;
+	if (list.empty()) {
+		return;
+	}
+	_chatProcess->prefetchRequested = true;
+	requestChatMessages(
+		_chatProcess->info.splits[_chatProcess->localSplitIndex],
+		list.back().id + 1,
+		-kMessagesSliceLimit,
+		kMessagesSliceLimit,
+		[=](MTPmessages_Messages &&result) {
+		Expects(_chatProcess != nullptr);
+
+		_chatProcess->prefetchRequested = false;
+		result.match([&](const MTPDmessages_messagesNotModified &data) {
+			error("Unexpected messagesNotModified received.");
+		}, [&](const auto &data) {
+			if constexpr (MTPDmessages_messages::Is<decltype(data)>()) {
+				_chatProcess->prefetchLastSlice = true;
+			}
+			_chatProcess->prefetched = Data::ParseMessagesSlice(
+				_chatProcess->context,
+				data.vmessages(),
+				data.vusers(),
+				data.vchats(),
+				_chatProcess->info.relativePath);
+			if (base::take(_chatProcess->sliceWanted)) {
+				requestMessagesSlice();
+			}
+		});
+	});
+}
+
 Data::Message *ApiWrap::currentFileMessage() const {
 	Expects(_chatProcess != nullptr);
 	Expects(_chatProcess->slice.has_value());
@@ -147,6 +147,7 @@ private:
 	void checkFirstMessageDate(int localSplitIndex, int count);
 	void messagesCountLoaded(int localSplitIndex, int count);
 	void requestMessagesSlice();
+	void prefetchMessagesSlice();
 	void requestChatMessages(
 		int splitIndex,
 		int offsetId,
@@ -23,6 +23,10 @@ namespace {
 
 using Context = details::JsonContext;
 
+// Accumulated data is flushed to disk as soon as it grows past this size,
+// so writing a huge chat slice never holds more than one such buffer.
+constexpr auto kMaxBytesInBlock = 512 * 1024;
+
 QByteArray SerializeString(const QByteArray &value) {
 	const auto size = value.size();
 	const auto begin = value.data();
@@ -675,6 +679,15 @@ QByteArray JsonWriter::popNesting() {
 		+ (type == Context::kObject ? '}' : ']');
 }
 
+Result JsonWriter::writeBlockIfLarge(QByteArray &block) {
+	Expects(_output != nullptr);
+
+	if (block.size() < kMaxBytesInBlock) {
+		return Result::Success();
+	}
+	return _output->writeBlock(base::take(block));
+}
+
 Result JsonWriter::writePersonal(const Data::PersonalInfo &data) {
 	Expects(_output != nullptr);
 
@@ -746,6 +759,9 @@ Result JsonWriter::writeUserpicsSlice(const Data::UserpicsSlice &data) {
 				SerializeString(path)
 			},
 		}));
+		if (const auto result = writeBlockIfLarge(block); !result) {
+			return result;
+		}
 	}
 	return _output->writeBlock(block);
 }
@@ -799,6 +815,9 @@ Result JsonWriter::writeSavedContacts(const Data::ContactsList &data) {
 				{ "date", SerializeDate(contact.date) }
 			}));
 		}
+		if (const auto result = writeBlockIfLarge(block); !result) {
+			return result;
+		}
 	}
 	block.append(popNesting());
 	return _output->writeBlock(block + popNesting());
@@ -1069,6 +1088,9 @@ Result JsonWriter::writeDialogSlice(const Data::MessagesSlice &data) {
 			message,
 			data.peers,
 			_environment.internalLinksDomain));
+		if (const auto result = writeBlockIfLarge(block); !result) {
+			return result;
+		}
 	}
 	return block.isEmpty() ? Result::Success() : _output->writeBlock(block);
 }
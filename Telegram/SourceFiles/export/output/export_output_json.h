@@ -73,6 +73,10 @@ private:
 	[[nodiscard]] QByteArray prepareArrayItemStart();
 	[[nodiscard]] QByteArray popNesting();
 
+	// Flushes the accumulated data if it grew past a fixed size limit,
+	// keeping memory usage bounded while writing arbitrary long slices.
+	[[nodiscard]] Result writeBlockIfLarge(QByteArray &block);
+
 	[[nodiscard]] QString mainFileRelativePath() const;
 	[[nodiscard]] QString pathWithRelativePath(const QString &path) const;
 	[[nodiscard]] std::unique_ptr<File> fileWithRelativePath(
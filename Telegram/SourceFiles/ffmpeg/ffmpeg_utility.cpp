@@ -17,6 +17,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #endif // LIB_FFMPEG_USE_QT_PRIVATE_API
 
 extern "C" {
+#include <libavutil/hwcontext.h>
 #include <libavutil/opt.h>
 } // extern "C"
 
@@ -82,6 +83,78 @@ void PremultiplyLine(uchar *dst, const uchar *src, int intsCount) {
 #endif // Qt >= 5.12
 }
 
+using GetFormatMethod = enum AVPixelFormat (*)(
+	AVCodecContext *context,
+	const enum AVPixelFormat *formats);
+
+template <AVPixelFormat Required>
+enum AVPixelFormat GetHwFormat(
+		AVCodecContext *context,
+		const enum AVPixelFormat *formats) {
+	for (auto format = formats; *format != AV_PIX_FMT_NONE; ++format) {
+		if (*format == Required) {
+			return *format;
+		}
+	}
+	// The hardware format is not offered for this stream,
+	// let the default implementation choose a software one.
+	return avcodec_default_get_format(context, formats);
+}
+
+[[nodiscard]] GetFormatMethod GetFormatForPixelFormat(AVPixelFormat format) {
+	switch (format) {
+#ifdef Q_OS_WIN
+	case AV_PIX_FMT_D3D11: return GetHwFormat<AV_PIX_FMT_D3D11>;
+	case AV_PIX_FMT_DXVA2_VLD: return GetHwFormat<AV_PIX_FMT_DXVA2_VLD>;
+#elif defined Q_OS_MAC // Q_OS_WIN
+	case AV_PIX_FMT_VIDEOTOOLBOX: return GetHwFormat<AV_PIX_FMT_VIDEOTOOLBOX>;
+#else // Q_OS_WIN || Q_OS_MAC
+	case AV_PIX_FMT_VAAPI: return GetHwFormat<AV_PIX_FMT_VAAPI>;
+	case AV_PIX_FMT_VDPAU: return GetHwFormat<AV_PIX_FMT_VDPAU>;
+#endif // Q_OS_WIN || Q_OS_MAC
+	default: return nullptr;
+	}
+}
+
+void TryEnableHardwareDecoding(
+		not_null<AVCodecContext*> context,
+		not_null<const AVCodec*> codec) {
+	for (auto i = 0;; ++i) {
+		const auto config = avcodec_get_hw_config(codec, i);
+		if (!config) {
+			return;
+		} else if (!(config->methods
+			& AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX)) {
+			continue;
+		}
+		const auto getFormat = GetFormatForPixelFormat(config->pix_fmt);
+		if (!getFormat) {
+			continue;
+		}
+		auto device = (AVBufferRef*)nullptr;
+		const auto error = AvErrorWrap(av_hwdevice_ctx_create(
+			&device,
+			config->device_type,
+			nullptr,
+			nullptr,
+			0));
+		if (error || !device) {
+			// Try the next hardware device type the codec supports.
+			continue;
+		}
+		DEBUG_LOG(("Video Info: Using hardware device '%1' for decoding."
+			).arg(av_hwdevice_get_type_name(config->device_type)));
+		context->hw_device_ctx = device;
+		context->get_format = getFormat;
+
+		// A few decoded frames are kept in the track queue before they
+		// get converted and presented, make sure the surface pool can
+		// hold them in addition to the frames the decoder requires.
+		context->extra_hw_frames = 4;
+		return;
+	}
+}
+
 } // namespace
 
 IOPointer MakeIOPointer(
@@ -160,7 +233,9 @@ void FormatDeleter::operator()(AVFormatContext *value) {
 	}
 }
 
-CodecPointer MakeCodecPointer(not_null<AVStream*> stream) {
+CodecPointer MakeCodecPointer(
+		not_null<AVStream*> stream,
+		bool allowHardwareAccel) {
 	auto error = AvErrorWrap();
 
 	auto result = CodecPointer(avcodec_alloc_context3(nullptr));
@@ -181,8 +256,17 @@ CodecPointer MakeCodecPointer(not_null<AVStream*> stream) {
 	if (!codec) {
 		LogError(qstr("avcodec_find_decoder"), context->codec_id);
 		return {};
-	} else if ((error = avcodec_open2(context, codec, nullptr))) {
+	}
+	if (allowHardwareAccel) {
+		TryEnableHardwareDecoding(context, codec);
+	}
+	if ((error = avcodec_open2(context, codec, nullptr))) {
 		LogError(qstr("avcodec_open2"), error);
+		if (context->hw_device_ctx) {
+			// The hardware decoder refused this stream,
+			// fall back to plain software decoding.
+			return MakeCodecPointer(stream, false);
+		}
 		return {};
 	}
 	return result;
@@ -136,7 +136,13 @@ struct CodecDeleter {
 	void operator()(AVCodecContext *value);
 };
 using CodecPointer = std::unique_ptr<AVCodecContext, CodecDeleter>;
-[[nodiscard]] CodecPointer MakeCodecPointer(not_null<AVStream*> stream);
+
+// With allowHardwareAccel the codec tries to use a platform hardware
+// decoder (DXVA / D3D11 on Windows, VideoToolbox on macOS, VA-API / VDPAU
+// on Linux), silently falling back to software decoding if none works.
+[[nodiscard]] CodecPointer MakeCodecPointer(
+	not_null<AVStream*> stream,
+	bool allowHardwareAccel = false);
 
 struct FrameDeleter {
 	void operator()(AVFrame *value);
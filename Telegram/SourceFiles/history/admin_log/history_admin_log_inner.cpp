@@ -61,6 +61,7 @@ constexpr auto kScrollDateHideTimeout = 1000;
 constexpr auto kEventsFirstPage = 20;
 constexpr auto kEventsPerPage = 50;
 constexpr auto kClearUserpicsAfter = 50;
+constexpr auto kUnloadHeavyPartsPages = 2;
 
 } // namespace
 
@@ -318,6 +319,13 @@ void InnerWidget::visibleTopBottomUpdated(
 		_userpicsCache = std::move(_userpics);
 	}
 
+	// Unload lottie animations.
+	const auto pages = kUnloadHeavyPartsPages;
+	const auto visibleAreaHeight = _visibleBottom - _visibleTop;
+	const auto from = _visibleTop - pages * visibleAreaHeight;
+	const auto till = _visibleBottom + pages * visibleAreaHeight;
+	session().data().unloadHeavyViewParts(this, from, till);
+
 	updateVisibleTopItem();
 	checkPreloadMore();
 	if (scrolledUp) {
@@ -2915,22 +2915,73 @@ HistoryItem *History::lastSentMessage() const {
 }
 
 void History::resizeToWidth(int newWidth) {
+	resizeToWidth(newWidth, 0, 0);
+}
+
+void History::resizeToWidth(int newWidth, int visibleTop, int visibleBottom) {
 	const auto resizeAllItems = (_width != newWidth);
 
-	if (!resizeAllItems && !hasPendingResizedItems()) {
+	if (!resizeAllItems
+		&& !hasPendingResizedItems()
+		&& !_hasLazyResizedBlocks) {
 		return;
 	}
 	_flags &= ~(Flag::f_has_pending_resized_items);
 
+	// Blocks a couple of viewport heights around the visible range are
+	// laid out now, the rest just keep their old heights and are marked
+	// pending, to be materialized when the viewport gets to them.
+	const auto hasViewport = (visibleBottom > visibleTop);
+	const auto slack = hasViewport ? 2 * (visibleBottom - visibleTop) : 0;
+
 	_width = newWidth;
+	_hasLazyResizedBlocks = false;
 	int y = 0;
 	for (const auto &block : blocks) {
+		const auto oldTop = block->y();
+		const auto oldBottom = oldTop + block->height();
 		block->setY(y);
-		y += block->resizeGetHeight(newWidth, resizeAllItems);
+		const auto needsFullResize = resizeAllItems || block->pendingResize();
+		if (needsFullResize
+			&& hasViewport
+			&& (oldBottom < visibleTop - slack
+				|| oldTop > visibleBottom + slack)) {
+			y += block->deferResizeGetHeight();
+			_hasLazyResizedBlocks = true;
+		} else {
+			y += block->resizeGetHeight(newWidth, resizeAllItems);
+		}
 	}
 	_height = y;
 }
 
+bool History::materializeBlocksInRange(int top, int bottom) {
+	if (!_hasLazyResizedBlocks) {
+		return false;
+	}
+	auto materialized = false;
+	auto stillLazy = false;
+	int y = 0;
+	for (const auto &block : blocks) {
+		block->setY(y);
+		if (block->pendingResize()
+			&& (y + block->height() > top)
+			&& (y < bottom)) {
+			y += block->resizeGetHeight(_width, false);
+			materialized = true;
+		} else {
+			stillLazy = stillLazy || block->pendingResize();
+			y += block->height();
+		}
+	}
+	_hasLazyResizedBlocks = stillLazy;
+	if (!materialized) {
+		return false;
+	}
+	_height = y;
+	return true;
+}
+
 void History::forceFullResize() {
 	_width = 0;
 	_flags |= Flag::f_has_pending_resized_items;
@@ -3319,6 +3370,9 @@ HistoryBlock::HistoryBlock(not_null<History*> history)
 }
 
 int HistoryBlock::resizeGetHeight(int newWidth, bool resizeAllItems) {
+	if (base::take(_pendingResize)) {
+		resizeAllItems = true;
+	}
 	auto y = 0;
 	for (const auto &message : messages) {
 		message->setY(y);
@@ -3332,6 +3386,11 @@ int HistoryBlock::resizeGetHeight(int newWidth, bool resizeAllItems) {
 	return _height;
 }
 
+int HistoryBlock::deferResizeGetHeight() {
+	_pendingResize = true;
+	return _height;
+}
+
 void HistoryBlock::remove(not_null<Element*> view) {
 	Expects(view->block() == this);
 
@@ -252,6 +252,8 @@ public:
 	HistoryItem *lastSentMessage() const;
 
 	void resizeToWidth(int newWidth);
+	void resizeToWidth(int newWidth, int visibleTop, int visibleBottom);
+	bool materializeBlocksInRange(int top, int bottom);
 	void forceFullResize();
 	int height() const;
 
@@ -528,6 +530,7 @@ private:
 	bool _mute = false;
 	int _width = 0;
 	int _height = 0;
+	bool _hasLazyResizedBlocks = false;
 	Element *_unreadBarView = nullptr;
 	Element *_firstUnreadView = nullptr;
 	HistoryService *_joinedMessage = nullptr;
@@ -598,6 +601,10 @@ public:
 	void refreshView(not_null<Element*> view);
 
 	int resizeGetHeight(int newWidth, bool resizeAllItems);
+	int deferResizeGetHeight();
+	[[nodiscard]] bool pendingResize() const {
+		return _pendingResize;
+	}
 	int y() const {
 		return _y;
 	}
@@ -642,5 +649,6 @@ protected:
 	int _y = 0;
 	int _height = 0;
 	int _indexInHistory = -1;
+	bool _pendingResize = false;
 
 };
@@ -10,6 +10,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include <rpl/merge.h>
 #include "core/file_utilities.h"
 #include "core/crash_reports.h"
+#include "core/paint_profiler.h"
 #include "history/history.h"
 #include "history/history_message.h"
 #include "history/view/media/history_view_media.h"
@@ -571,6 +572,9 @@ void HistoryInner::paintEvent(QPaintEvent *e) {
 		_userpicsCache.clear();
 	});
 
+	static auto profiler = Core::PaintProfiler("HistoryInner");
+	const auto scope = Core::PaintProfilerScope(profiler);
+
 	Painter p(this);
 	auto clip = e->rect();
 	auto ms = crl::now();
@@ -2089,7 +2093,15 @@ void HistoryInner::recountHistoryGeometry() {
 		accumulate_max(oldHistoryPaddingTop, st::msgMargin.top() + st::msgMargin.bottom() + st::msgPadding.top() + st::msgPadding.bottom() + st::msgNameFont->height + st::botDescSkip + _botAbout->height);
 	}
 
-	_history->resizeToWidth(_contentWidth);
+	const auto htop = historyTop();
+	if (htop >= 0) {
+		_history->resizeToWidth(
+			_contentWidth,
+			_visibleAreaTop - htop,
+			_visibleAreaBottom - htop);
+	} else {
+		_history->resizeToWidth(_contentWidth);
+	}
 	if (_migrated) {
 		_migrated->resizeToWidth(_contentWidth);
 	}
@@ -2212,6 +2224,17 @@ void HistoryInner::visibleAreaUpdated(int top, int bottom) {
 		return;
 	}
 
+	// Materialize layout of blocks deferred by a lazy resizeToWidth()
+	// that ended up under (or near) the viewport.
+	if (const auto htop = historyTop(); htop >= 0) {
+		const auto slack = visibleAreaHeight;
+		if (_history->materializeBlocksInRange(
+				top - htop - slack,
+				bottom - htop + slack)) {
+			updateSize();
+		}
+	}
+
 	if (bottom >= _historyPaddingTop + historyHeight() + st::historyPaddingBottom) {
 		_history->forgetScrollState();
 		if (_migrated) {
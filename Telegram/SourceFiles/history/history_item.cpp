@@ -43,6 +43,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_user.h"
 #include "observer_peer.h"
 #include "facades.h"
+#include "app.h"
 #include "styles/style_dialogs.h"
 #include "styles/style_history.h"
 
@@ -854,19 +855,51 @@ void HistoryItem::drawInDialog(
 		bool selected,
 		DrawInDialog way,
 		const HistoryItem *&cacheFor,
-		Ui::Text::String &cache) const {
+		Ui::Text::String &cache,
+		Dialogs::RowTextCache &pixmapCache) const {
 	if (r.isEmpty()) {
 		return;
 	}
 	if (cacheFor != this) {
 		cacheFor = this;
 		cache.setText(st::dialogsTextStyle, inDialogsText(way), Ui::DialogTextOptions());
+		pixmapCache = Dialogs::RowTextCache();
+	}
+	const auto &palette = active
+		? st::dialogsTextPaletteActive
+		: (selected ? st::dialogsTextPaletteOver : st::dialogsTextPalette);
+	const auto &fg = active
+		? st::dialogsTextFgActive
+		: (selected ? st::dialogsTextFgOver : st::dialogsTextFg);
+	const auto state = active ? 2 : selected ? 1 : 0;
+	if (pixmapCache.pixmap.size() != r.size() * cIntRetinaFactor()
+		|| pixmapCache.state != state
+		|| pixmapCache.fg != fg->c
+		|| pixmapCache.linkFg != palette.linkFg->c) {
+		auto image = QImage(
+			r.size() * cIntRetinaFactor(),
+			QImage::Format_ARGB32_Premultiplied);
+		image.setDevicePixelRatio(cRetinaFactor());
+		image.fill(Qt::transparent);
+		{
+			Painter q(&image);
+			q.setTextPalette(palette);
+			q.setFont(st::dialogsTextFont);
+			q.setPen(fg);
+			cache.drawElided(
+				q,
+				0,
+				0,
+				r.width(),
+				r.height() / st::dialogsTextFont->height);
+			q.restoreTextPalette();
+		}
+		pixmapCache.pixmap = App::pixmapFromImageInPlace(std::move(image));
+		pixmapCache.state = state;
+		pixmapCache.fg = fg->c;
+		pixmapCache.linkFg = palette.linkFg->c;
 	}
-	p.setTextPalette(active ? st::dialogsTextPaletteActive : (selected ? st::dialogsTextPaletteOver : st::dialogsTextPalette));
-	p.setFont(st::dialogsTextFont);
-	p.setPen(active ? st::dialogsTextFgActive : (selected ? st::dialogsTextFgOver : st::dialogsTextFg));
-	cache.drawElided(p, r.left(), r.top(), r.width(), r.height() / st::dialogsTextFont->height);
-	p.restoreTextPalette();
+	p.drawPixmap(r.topLeft(), pixmapCache.pixmap);
 }
 
 HistoryItem::~HistoryItem() = default;
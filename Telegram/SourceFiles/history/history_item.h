@@ -11,6 +11,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/flags.h"
 #include "base/value_ordering.h"
 #include "data/data_media_types.h"
+#include "history/history_item_pool.h"
 
 enum class UnreadMentionType;
 struct HistoryMessageReplyMarkup;
@@ -41,6 +42,10 @@ struct MessagePosition;
 class Media;
 } // namespace Data
 
+namespace Dialogs {
+struct RowTextCache;
+} // namespace Dialogs
+
 namespace Window {
 class SessionController;
 } // namespace Window
@@ -64,6 +69,13 @@ public:
 		const MTPMessage &message,
 		MTPDmessage_ClientFlags clientFlags);
 
+	static void *operator new(std::size_t size) {
+		return HistoryPool::Allocate(size);
+	}
+	static void operator delete(void *pointer, std::size_t size) {
+		HistoryPool::Free(pointer, size);
+	}
+
 	struct Destroyer {
 		void operator()(HistoryItem *value);
 	};
@@ -253,7 +265,8 @@ public:
 		bool selected,
 		DrawInDialog way,
 		const HistoryItem *&cacheFor,
-		Ui::Text::String &cache) const;
+		Ui::Text::String &cache,
+		Dialogs::RowTextCache &pixmapCache) const;
 
 	[[nodiscard]] bool emptyText() const {
 		return _text.isEmpty();
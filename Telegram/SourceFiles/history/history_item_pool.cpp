@@ -0,0 +1,72 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "history/history_item_pool.h"
+
+namespace HistoryPool {
+namespace {
+
+constexpr auto kAlignment = std::size_t(64);
+constexpr auto kMaxPooledSize = std::size_t(1024);
+constexpr auto kSizeClassesCount = kMaxPooledSize / kAlignment;
+constexpr auto kSlabSize = std::size_t(64 * 1024);
+
+struct FreeNode {
+	FreeNode *next = nullptr;
+};
+
+struct SizeClass {
+	FreeNode *free = nullptr;
+	char *slabPosition = nullptr;
+	char *slabEnd = nullptr;
+};
+
+std::vector<std::unique_ptr<char[]>> Slabs;
+SizeClass SizeClasses[kSizeClassesCount];
+
+[[nodiscard]] std::size_t ClassIndex(std::size_t size) {
+	Expects(size > 0 && size <= kMaxPooledSize);
+
+	return (size + kAlignment - 1) / kAlignment - 1;
+}
+
+} // namespace
+
+void *Allocate(std::size_t size) {
+	if (size == 0 || size > kMaxPooledSize) {
+		return ::operator new(size);
+	}
+	auto &list = SizeClasses[ClassIndex(size)];
+	if (const auto node = list.free) {
+		list.free = node->next;
+		return node;
+	}
+	const auto rounded = (ClassIndex(size) + 1) * kAlignment;
+	if (std::size_t(list.slabEnd - list.slabPosition) < rounded) {
+		Slabs.push_back(std::make_unique<char[]>(kSlabSize));
+		list.slabPosition = Slabs.back().get();
+		list.slabEnd = list.slabPosition + kSlabSize;
+	}
+	const auto result = list.slabPosition;
+	list.slabPosition += rounded;
+	return result;
+}
+
+void Free(void *pointer, std::size_t size) {
+	if (!pointer) {
+		return;
+	} else if (size == 0 || size > kMaxPooledSize) {
+		::operator delete(pointer);
+		return;
+	}
+	auto &list = SizeClasses[ClassIndex(size)];
+	const auto node = static_cast<FreeNode*>(pointer);
+	node->next = list.free;
+	list.free = node;
+}
+
+} // namespace HistoryPool
@@ -0,0 +1,24 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+namespace HistoryPool {
+
+// Slab allocator for HistoryItem-s and HistoryView::Element-s.
+//
+// Loading a long history produces hundreds of thousands of small
+// allocations with very similar sizes and lifetimes. Serving them
+// from reusable slabs keeps them tightly packed for block walking
+// and takes the pressure off the general-purpose allocator.
+//
+// Main thread only. Allocations larger than the largest size class
+// fall back to the general-purpose allocator.
+[[nodiscard]] void *Allocate(std::size_t size);
+void Free(void *pointer, std::size_t size);
+
+} // namespace HistoryPool
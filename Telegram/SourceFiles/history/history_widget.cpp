@@ -123,6 +123,8 @@ constexpr auto kDisplayEditTimeWarningMs = 300 * 1000;
 constexpr auto kFullDayInMs = 86400 * 1000;
 constexpr auto kCancelTypingActionTimeout = crl::time(5000);
 constexpr auto kSaveDraftTimeout = 1000;
+constexpr auto kPreviewCacheLifetime = 30 * 60 * crl::time(1000);
+constexpr auto kPreviewCacheLimit = 128;
 constexpr auto kSaveDraftAnywayTimeout = 5000;
 constexpr auto kSaveCloudDraftIdleTimeout = 14000;
 constexpr auto kRecordingUpdateDelta = crl::time(100);
@@ -1766,7 +1768,6 @@ void HistoryWidget::showHistory(
 	_replyEditMsg = nullptr;
 	_editMsgId = _replyToId = 0;
 	_previewData = nullptr;
-	_previewCache.clear();
 	_fieldBarCancel->hide();
 
 	_membersDropdownShowTimer.stop();
@@ -1823,6 +1824,7 @@ void HistoryWidget::showHistory(
 			_migrated->clear(History::ClearType::Unload);
 		}
 		_history->setFakeUnreadWhileOpened(true);
+		_history->owner().registerChatOpen(_peer);
 
 		_topBar->setActiveChat(
 			_history,
@@ -6273,6 +6275,18 @@ void HistoryWidget::previewCancel() {
 	updatePreview();
 }
 
+void HistoryWidget::cachePreviewResult(const QString &links, WebPageId id) {
+	// Both resolved pages and known-empty results are kept for a while,
+	// so retyping the same links does not wait on the network again.
+	if (_previewCache.size() >= kPreviewCacheLimit) {
+		_previewCache.clear();
+	}
+	_previewCache[links] = {
+		id,
+		crl::now() + kPreviewCacheLifetime,
+	};
+}
+
 void HistoryWidget::checkPreview() {
 	const auto previewRestricted = [&] {
 		return _peer && _peer->amRestricted(ChatRestriction::f_embed_links);
@@ -6290,16 +6304,17 @@ void HistoryWidget::checkPreview() {
 				previewCancel();
 			}
 		} else {
-			const auto i = _previewCache.constFind(_previewLinks);
-			if (i == _previewCache.cend()) {
+			const auto i = _previewCache.find(_previewLinks);
+			if (i == _previewCache.end()
+				|| i->second.goodTill <= crl::now()) {
 				_previewRequest = MTP::send(
 					MTPmessages_GetWebPagePreview(
 						MTP_flags(0),
 						MTP_string(_previewLinks),
 						MTPVector<MTPMessageEntity>()),
 					rpcDone(&HistoryWidget::gotPreview, _previewLinks));
-			} else if (i.value()) {
-				_previewData = session().data().webpage(i.value());
+			} else if (i->second.id) {
+				_previewData = session().data().webpage(i->second.id);
 				updatePreview();
 			} else {
 				if (_previewData && _previewData->pendingTill >= 0) previewCancel();
@@ -6329,7 +6344,7 @@ void HistoryWidget::gotPreview(QString links, const MTPMessageMedia &result, mtp
 	if (result.type() == mtpc_messageMediaWebPage) {
 		const auto &data = result.c_messageMediaWebPage().vwebpage();
 		const auto page = session().data().processWebpage(data);
-		_previewCache.insert(links, page->id);
+		cachePreviewResult(links, page->id);
 		if (page->pendingTill > 0 && page->pendingTill <= base::unixtime::now()) {
 			page->pendingTill = -1;
 		}
@@ -6341,7 +6356,7 @@ void HistoryWidget::gotPreview(QString links, const MTPMessageMedia &result, mtp
 		}
 		session().data().sendWebPageGamePollNotifications();
 	} else if (result.type() == mtpc_messageMediaEmpty) {
-		_previewCache.insert(links, 0);
+		cachePreviewResult(links, 0);
 		if (links == _previewLinks && !_previewCancelled) {
 			_previewData = nullptr;
 			updatePreview();
@@ -577,6 +577,7 @@ private:
 	void saveEditMsgDone(History *history, const MTPUpdates &updates, mtpRequestId req);
 	bool saveEditMsgFail(History *history, const RPCError &error, mtpRequestId req);
 
+	void cachePreviewResult(const QString &links, WebPageId id);
 	void checkPreview();
 	void requestPreview();
 	void gotPreview(QString links, const MTPMessageMedia &media, mtpRequestId req);
@@ -674,8 +675,11 @@ private:
 	QStringList _parsedLinks;
 	QString _previewLinks;
 	WebPageData *_previewData = nullptr;
-	typedef QMap<QString, WebPageId> PreviewCache;
-	PreviewCache _previewCache;
+	struct PreviewCacheEntry {
+		WebPageId id = 0;
+		crl::time goodTill = 0;
+	};
+	base::flat_map<QString, PreviewCacheEntry> _previewCache;
 	mtpRequestId _previewRequest = 0;
 	Ui::Text::String _previewTitle;
 	Ui::Text::String _previewDescription;
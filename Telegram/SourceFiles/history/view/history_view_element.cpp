@@ -22,6 +22,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_groups.h"
 #include "data/data_media_types.h"
 #include "lang/lang_keys.h"
+#include "window/themes/window_theme.h"
 #include "layout.h"
 #include "facades.h"
 #include "app.h"
@@ -33,6 +34,28 @@ namespace {
 // A new message from the same sender is attached to previous within 15 minutes.
 constexpr int kAttachMessageToPreviousSecondsDelta = 900;
 
+// Total budget for cached full-element render layers.
+constexpr auto kRenderCacheLimit = int64(8 * 1024 * 1024);
+
+struct RenderCacheRegistry : public base::Subscriber {
+	RenderCacheRegistry() {
+		subscribe(Window::Theme::Background(), [](
+				const Window::Theme::BackgroundUpdate &update) {
+			if (update.paletteChanged()) {
+				Element::ClearRenderCaches();
+			}
+		});
+	}
+
+	std::list<not_null<const Element*>> order;
+	int64 total = 0;
+};
+
+[[nodiscard]] RenderCacheRegistry &RenderCaches() {
+	static auto result = RenderCacheRegistry();
+	return result;
+}
+
 bool IsAttachedToPreviousInSavedMessages(
 		not_null<HistoryItem*> previous,
 		not_null<HistoryItem*> item) {
@@ -251,6 +274,114 @@ void Element::setY(int y) {
 void Element::refreshDataIdHook() {
 }
 
+struct Element::RenderCache {
+	QPixmap pixmap;
+	std::list<not_null<const Element*>>::iterator position;
+	int64 bytes = 0;
+	int width = 0;
+	int height = 0;
+	bool selected = false;
+};
+
+bool Element::paintFromRenderCache(
+		Painter &p,
+		TextSelection selection) const {
+	if (_renderingToCache || !canCacheRender(selection)) {
+		return false;
+	}
+	const auto selected = (selection == FullSelection);
+	validateRenderCache(selected);
+	if (!_renderCache) {
+		return false;
+	}
+	touchRenderCache();
+	p.drawPixmap(0, 0, _renderCache->pixmap);
+	return true;
+}
+
+bool Element::canCacheRender(TextSelection selection) const {
+	return false;
+}
+
+void Element::validateRenderCache(bool selected) const {
+	if (_renderCache
+		&& _renderCache->width == width()
+		&& _renderCache->height == height()
+		&& _renderCache->selected == selected) {
+		return;
+	}
+	dropRenderCache();
+	if (width() <= 0 || height() <= 0) {
+		return;
+	}
+	const auto bytes = int64(width())
+		* height()
+		* cIntRetinaFactor()
+		* cIntRetinaFactor()
+		* 4;
+	if (bytes > kRenderCacheLimit / 2) {
+		return;
+	}
+	auto image = QImage(
+		QSize(width(), height()) * cIntRetinaFactor(),
+		QImage::Format_ARGB32_Premultiplied);
+	image.setDevicePixelRatio(cRetinaFactor());
+	image.fill(Qt::transparent);
+	{
+		Painter q(&image);
+		_renderingToCache = true;
+		draw(
+			q,
+			QRect(0, 0, width(), height()),
+			selected ? FullSelection : TextSelection(),
+			crl::now());
+		_renderingToCache = false;
+	}
+	auto cache = std::make_unique<RenderCache>();
+	cache->pixmap = App::pixmapFromImageInPlace(std::move(image));
+	cache->bytes = bytes;
+	cache->width = width();
+	cache->height = height();
+	cache->selected = selected;
+
+	auto &registry = RenderCaches();
+	registry.order.push_back(this);
+	cache->position = std::prev(registry.order.end());
+	registry.total += bytes;
+	_renderCache = std::move(cache);
+	while (registry.total > kRenderCacheLimit) {
+		Assert(registry.order.front() != this);
+		registry.order.front()->dropRenderCache();
+	}
+}
+
+void Element::touchRenderCache() const {
+	Expects(_renderCache != nullptr);
+
+	auto &registry = RenderCaches();
+	registry.order.splice(
+		registry.order.end(),
+		registry.order,
+		_renderCache->position);
+}
+
+void Element::dropRenderCache() const {
+	if (!_renderCache) {
+		return;
+	}
+	auto &registry = RenderCaches();
+	registry.total -= _renderCache->bytes;
+	registry.order.erase(_renderCache->position);
+	_renderCache = nullptr;
+}
+
+void Element::ClearRenderCaches() {
+	auto &registry = RenderCaches();
+	while (!registry.order.empty()) {
+		registry.order.front()->dropRenderCache();
+	}
+}
+
 void Element::paintHighlight(
 		Painter &p,
 		int geometryHeight) const {
@@ -493,6 +624,7 @@ QSize Element::countOptimalSize() {
 }
 
 QSize Element::countCurrentSize(int newWidth) {
+	dropRenderCache();
 	if (_flags & Flag::NeedsResize) {
 		_flags &= ~Flag::NeedsResize;
 		initDimensions();
@@ -723,6 +855,7 @@ void Element::clickHandlerActiveChanged(
 		}
 	}
 	App::hoveredLinkItem(active ? this : nullptr);
+	dropRenderCache();
 	history()->owner().requestViewRepaint(this);
 	if (const auto media = this->media()) {
 		media->clickHandlerActiveChanged(handler, active);
@@ -738,6 +871,7 @@ void Element::clickHandlerPressedChanged(
 		}
 	}
 	App::pressedLinkItem(pressed ? this : nullptr);
+	dropRenderCache();
 	history()->owner().requestViewRepaint(this);
 	if (const auto media = this->media()) {
 		media->clickHandlerPressedChanged(handler, pressed);
@@ -745,6 +879,8 @@ void Element::clickHandlerPressedChanged(
 }
 
 Element::~Element() {
+	dropRenderCache();
+
 	// Delete media while owner still exists.
 	base::take(_media);
 	if (_data->mainView() == this) {
@@ -8,6 +8,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #pragma once
 
 #include "history/view/history_view_object.h"
+#include "history/history_item_pool.h"
 #include "base/runtime_composer.h"
 #include "base/flags.h"
 
@@ -136,6 +137,13 @@ public:
 		not_null<ElementDelegate*> delegate,
 		not_null<HistoryItem*> data);
 
+	static void *operator new(std::size_t size) {
+		return HistoryPool::Allocate(size);
+	}
+	static void operator delete(void *pointer, std::size_t size) {
+		HistoryPool::Free(pointer, size);
+	}
+
 	enum class Flag : uchar {
 		NeedsResize        = 0x01,
 		AttachedToPrevious = 0x02,
@@ -264,6 +272,8 @@ public:
 	void checkHeavyPart();
 	void unloadHeavyPart();
 
+	static void ClearRenderCaches();
+
 	// Legacy blocks structure.
 	HistoryBlock *block();
 	const HistoryBlock *block() const;
@@ -284,9 +294,20 @@ protected:
 		Painter &p,
 		int geometryHeight) const;
 
+	// Blits a cached full-element layer if canCacheRender() allows it,
+	// rendering and caching the layer first when necessary.
+	bool paintFromRenderCache(Painter &p, TextSelection selection) const;
+	[[nodiscard]] virtual bool canCacheRender(TextSelection selection) const;
+
 	virtual void refreshDataIdHook();
 
 private:
+	struct RenderCache;
+
+	void validateRenderCache(bool selected) const;
+	void touchRenderCache() const;
+	void dropRenderCache() const;
+
 	// This should be called only from previousInBlocksChanged()
 	// to add required bits to the Composer mask
 	// after that always use Has<DateBadge>().
@@ -309,6 +330,8 @@ private:
 	const not_null<ElementDelegate*> _delegate;
 	const not_null<HistoryItem*> _data;
 	std::unique_ptr<Media> _media;
+	mutable std::unique_ptr<RenderCache> _renderCache;
+	mutable bool _renderingToCache = false;
 	bool _isScheduledUntilOnline = false;
 	const QDateTime _dateTime;
 
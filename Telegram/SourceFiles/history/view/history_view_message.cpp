@@ -390,6 +390,9 @@ void Message::draw(
 	if (g.width() < 1) {
 		return;
 	}
+	if (paintFromRenderCache(p, selection)) {
+		return;
+	}
 
 	const auto item = message();
 	const auto media = this->media();
@@ -1445,6 +1448,27 @@ void Message::refreshDataIdHook() {
 	}
 }
 
+bool Message::canCacheRender(TextSelection selection) const {
+	if (selection != TextSelection() && selection != FullSelection) {
+		return false;
+	}
+	const auto item = message();
+	return drawBubble()
+		&& !isHidden()
+		&& !this->media()
+		&& !item->inlineReplyKeyboard()
+		&& !item->isSending()
+		&& !item->hasFailed()
+		&& !(item->out() && item->unread())
+		&& !Has<UnreadBar>()
+		&& !displayRightAction()
+		&& !(hasFastReply() && isUnderCursor())
+		&& !delegate()->elementHighlightTime(this)
+		&& !(displayFromName()
+			&& item->displayFrom()
+			&& item->displayFrom()->nameVersion > item->_fromNameVersion);
+}
+
 int Message::timeLeft() const {
 	const auto item = message();
 	auto result = 0;
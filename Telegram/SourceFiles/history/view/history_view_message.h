@@ -99,6 +99,7 @@ public:
 
 protected:
 	void refreshDataIdHook() override;
+	bool canCacheRender(TextSelection selection) const override;
 
 private:
 	not_null<HistoryMessage*> message() const;
@@ -26,6 +26,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace HistoryView {
 namespace {
 
+constexpr auto kMaxCachedDateBadges = 64;
+
 enum CircleMask {
 	NormalMask     = 0x00,
 	InvertedMask   = 0x01,
@@ -49,6 +51,10 @@ public:
 
 	// corners[(CircleMask value) * MaskMultiplier | (CornerVerticalSide value) | (CornerHorizontalSide value)]
 	QPixmap corners[8];
+
+	// Each distinct day on screen paints the same badge many times,
+	// so the fully rendered bubble with text is cached per date text.
+	base::flat_map<QString, QPixmap> dateBadges;
 };
 Data::GlobalStructurePointer<ServiceMessageStyleData> serviceMessageStyle;
 
@@ -161,6 +167,37 @@ void paintBubblePart(Painter &p, int x, int y, int width, int height, SideStyle
 	p.fillRect(x, y, width, height, st::msgServiceBg);
 }
 
+const QPixmap &dateBadgePixmap(const QString &dateText, int dateTextWidth) {
+	createCircleMasks();
+
+	auto &badges = serviceMessageStyle->dateBadges;
+	const auto i = badges.find(dateText);
+	if (i != badges.end()) {
+		return i->second;
+	}
+	if (badges.size() >= kMaxCachedDateBadges) {
+		badges.clear();
+	}
+	int width = dateTextWidth + st::msgServicePadding.left() + st::msgServicePadding.left();
+	int height = st::msgServicePadding.top() + st::msgServiceFont->height + st::msgServicePadding.bottom();
+	auto result = QImage(
+		QSize(width, height) * cIntRetinaFactor(),
+		QImage::Format_ARGB32_Premultiplied);
+	result.fill(Qt::transparent);
+	result.setDevicePixelRatio(cRetinaFactor());
+	{
+		Painter p(&result);
+		ServiceMessagePainter::paintBubble(p, 0, 0, width, height);
+		p.setFont(st::msgServiceFont);
+		p.setPen(st::msgServiceFg);
+		p.drawText(st::msgServicePadding.left(), st::msgServicePadding.top() + st::msgServiceFont->ascent, dateText);
+	}
+	return badges.emplace(
+		dateText,
+		App::pixmapFromImageInPlace(std::move(result))
+	).first->second;
+}
+
 void paintPreparedDate(Painter &p, const QString &dateText, int dateTextWidth, int y, int w) {
 	int left = st::msgServiceMargin.left();
 	int maxwidth = w;
@@ -170,12 +207,10 @@ void paintPreparedDate(Painter &p, const QString &dateText, int dateTextWidth, i
 	w = maxwidth - st::msgServiceMargin.left() - st::msgServiceMargin.left();
 
 	left += (w - dateTextWidth - st::msgServicePadding.left() - st::msgServicePadding.right()) / 2;
-	int height = st::msgServicePadding.top() + st::msgServiceFont->height + st::msgServicePadding.bottom();
-	ServiceMessagePainter::paintBubble(p, left, y + st::msgServiceMargin.top(), dateTextWidth + st::msgServicePadding.left() + st::msgServicePadding.left(), height);
-
-	p.setFont(st::msgServiceFont);
-	p.setPen(st::msgServiceFg);
-	p.drawText(left + st::msgServicePadding.left(), y + st::msgServiceMargin.top() + st::msgServicePadding.top() + st::msgServiceFont->ascent, dateText);
+	p.drawPixmap(
+		left,
+		y + st::msgServiceMargin.top(),
+		dateBadgePixmap(dateText, dateTextWidth));
 }
 
 bool NeedAboutGroup(not_null<History*> history) {
@@ -304,6 +339,7 @@ void serviceColorsUpdated() {
 		for (auto &corner : serviceMessageStyle->corners) {
 			corner = QPixmap();
 		}
+		serviceMessageStyle->dateBadges.clear();
 	}
 }
 
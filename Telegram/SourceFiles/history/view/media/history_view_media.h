@@ -261,6 +261,8 @@ public:
 	// Should be called only by Data::Session.
 	virtual void updateSharedContactUserId(UserId userId) {
 	}
+	virtual void updatePollResults() {
+	}
 	virtual void parentTextUpdated() {
 	}
 
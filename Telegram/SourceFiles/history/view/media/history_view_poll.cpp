@@ -417,6 +417,30 @@ void Poll::updateTexts() {
 		first ? anim::type::instant : anim::type::normal);
 }
 
+void Poll::updatePollResults() {
+	// A results-only change: the question and answer texts are intact,
+	// so the votes state is refreshed without re-measuring the bubble.
+	if (_pollVersion == _poll->version) {
+		return;
+	}
+	_pollVersion = _poll->version;
+
+	const auto willStartAnimation = checkAnimationStart();
+	const auto voted = _voted;
+
+	updateRecentVoters();
+	updateAnswers();
+	updateVotes();
+
+	if (willStartAnimation) {
+		startAnswersAnimation();
+		if (!voted) {
+			checkQuizAnswered();
+		}
+	}
+	solutionToggled(_solutionShown);
+}
+
 void Poll::checkQuizAnswered() {
 	if (!_voted || !_votedFromHere || !_poll->quiz() || anim::Disabled()) {
 		return;
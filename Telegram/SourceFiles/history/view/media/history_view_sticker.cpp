@@ -156,6 +156,11 @@ void Sticker::paintLottie(Painter &p, const QRect &r, bool selected) {
 	const auto &image = _lastDiceFrame.isNull()
 		? frame.image
 		: _lastDiceFrame;
+	if (!selected && !frame.image.isNull() && _lastDiceFrame.isNull()) {
+		auto first = QPixmap::fromImage(frame.image, Qt::ColorOnly);
+		first.setDevicePixelRatio(cRetinaFactor());
+		_dataMedia->setLottieFirstFrame(std::move(first));
+	}
 	const auto prepared = (!_lastDiceFrame.isNull() && selected)
 		? Images::prepareColored(st::msgStickerOverlay->c, image)
 		: image;
@@ -211,6 +216,13 @@ QPixmap Sticker::paintedPixmap(bool selected) const {
 	const auto w = _size.width();
 	const auto h = _size.height();
 	const auto &c = st::msgStickerOverlay;
+	if (!selected) {
+		const auto &first = _dataMedia->lottieFirstFrame();
+		if (!first.isNull()
+			&& first.size() == _size * cIntRetinaFactor()) {
+			return first;
+		}
+	}
 	const auto good = _dataMedia->goodThumbnail();
 	if (const auto image = _dataMedia->getStickerLarge()) {
 		return selected
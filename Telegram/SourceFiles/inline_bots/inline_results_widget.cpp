@@ -1049,12 +1049,26 @@ void Widget::inlineResultsDone(const MTPmessages_BotResults &result) {
 		auto &v = d.vresults().v;
 		auto queryId = d.vquery_id().v;
 
+		if (adding && base::take(it->second->revalidating)) {
+			// The stale results are on screen, drop the rows and
+			// layouts referencing them before they get destroyed.
+			_inner->refreshInlineRows(
+				_inlineQueryPeer,
+				_inlineBot,
+				nullptr,
+				true);
+			it->second->results.clear();
+			it->second->switchPmText = QString();
+			it->second->switchPmStartToken = QString();
+			adding = false;
+		}
 		if (it == _inlineCache.cend()) {
 			it = _inlineCache.emplace(
 				_inlineQuery,
 				std::make_unique<internal::CacheEntry>()).first;
 		}
 		auto entry = it->second.get();
+		entry->expires = crl::now() + d.vcache_time().v * crl::time(1000);
 		entry->nextOffset = qs(d.vnext_offset().value_or_empty());
 		if (const auto switchPm = d.vswitch_pm()) {
 			switchPm->match([&](const MTPDinlineBotSwitchPM &data) {
@@ -1106,10 +1120,17 @@ void Widget::queryInlineBot(UserData *bot, PeerData *peer, QString query) {
 			_inlineRequestId = 0;
 			Notify::inlineBotRequesting(false);
 		}
-		if (_inlineCache.find(query) != _inlineCache.cend()) {
-			_inlineRequestTimer.stop();
+		const auto i = _inlineCache.find(query);
+		if (i != _inlineCache.cend()) {
 			_inlineQuery = _inlineNextQuery = query;
 			showInlineRows(true);
+			if (i->second->expires > crl::now()) {
+				_inlineRequestTimer.stop();
+			} else {
+				// The bot's cache_time has passed, show the cached
+				// results right away and refresh them quietly.
+				_inlineRequestTimer.start(internal::kInlineBotRequestDelay);
+			}
 		} else {
 			_inlineNextQuery = query;
 			_inlineRequestTimer.start(internal::kInlineBotRequestDelay);
@@ -1124,9 +1145,15 @@ void Widget::onInlineRequest() {
 	QString nextOffset;
 	auto it = _inlineCache.find(_inlineQuery);
 	if (it != _inlineCache.cend()) {
-		nextOffset = it->second->nextOffset;
-		if (nextOffset.isEmpty()) {
-			return;
+		if (it->second->expires <= crl::now()) {
+			// Refetch the stale entry from scratch, the results
+			// stay on screen until the fresh ones replace them.
+			it->second->revalidating = true;
+		} else {
+			nextOffset = it->second->nextOffset;
+			if (nextOffset.isEmpty()) {
+				return;
+			}
 		}
 	}
 	Notify::inlineBotRequesting(true);
@@ -49,6 +49,8 @@ struct CacheEntry {
 	QString nextOffset;
 	QString switchPmText, switchPmStartToken;
 	Results results;
+	crl::time expires = 0;
+	bool revalidating = false;
 };
 
 class Inner
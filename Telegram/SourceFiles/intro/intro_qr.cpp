@@ -50,19 +50,30 @@ namespace {
 	return result;
 }
 
-[[nodiscard]] QImage TelegramQrExact(const Qr::Data &data, int pixel) {
-	return Qr::Generate(data, pixel, st::windowFg->c);
+[[nodiscard]] QImage TelegramQrExact(
+		const Qr::Data &data,
+		int pixel,
+		QColor fg) {
+	return Qr::Generate(data, pixel, fg);
 }
 
-[[nodiscard]] QImage TelegramQr(const Qr::Data &data, int pixel, int max = 0) {
+[[nodiscard]] QImage TelegramQr(
+		const Qr::Data &data,
+		int pixel,
+		int max,
+		QColor fg,
+		QColor bg) {
 	Expects(data.size > 0);
 
 	if (max > 0 && data.size * pixel > max) {
 		pixel = std::max(max / data.size, 1);
 	}
-	const auto qr = TelegramQrExact(data, pixel * style::DevicePixelRatio());
+	const auto qr = TelegramQrExact(
+		data,
+		pixel * style::DevicePixelRatio(),
+		fg);
 	auto result = QImage(qr.size(), QImage::Format_ARGB32_Premultiplied);
-	result.fill(st::windowBg->c);
+	result.fill(bg);
 	{
 		auto p = QPainter(&result);
 		p.drawImage(QRect(QPoint(), qr.size()), qr);
@@ -81,14 +92,10 @@ namespace {
 		QImage previous;
 		QImage qr;
 		QImage center;
+		int version = 0;
 		Ui::Animations::Simple shown;
 		Ui::InfiniteRadialAnimation waiting;
 	};
-	auto qrs = std::move(
-		codes
-	) | rpl::map([](const QByteArray &code) {
-		return Qr::Encode(code, Qr::Redundancy::Quartile);
-	});
 	auto palettes = rpl::single(
 		rpl::empty_value()
 	) | rpl::then(
@@ -100,20 +107,40 @@ namespace {
 	state->waiting.start();
 	result->resize(st::introQrMaxSize, st::introQrMaxSize);
 	rpl::combine(
-		std::move(qrs),
+		std::move(codes),
 		rpl::duplicate(palettes)
-	) | rpl::map([](const Qr::Data &code, const auto &) {
-		return TelegramQr(code, st::introQrPixel, st::introQrMaxSize);
-	}) | rpl::start_with_next([=](QImage &&image) {
-		state->previous = std::move(state->qr);
-		state->qr = std::move(image);
-		state->waiting.stop();
-		state->shown.stop();
-		state->shown.start(
-			[=] { result->update(); },
-			0.,
-			1.,
-			st::fadeWrapDuration);
+	) | rpl::start_with_next([=](const QByteArray &code, const auto &) {
+		// Encoding and rendering the code costs a few milliseconds,
+		// so it is done on a background thread - the old code keeps
+		// showing till the fresh image is ready for the swap.
+		const auto version = ++state->version;
+		const auto weak = Ui::MakeWeak(result);
+		crl::async([=,
+			pixel = int(st::introQrPixel),
+			max = int(st::introQrMaxSize),
+			fg = st::windowFg->c,
+			bg = st::windowBg->c] {
+			auto image = TelegramQr(
+				Qr::Encode(code, Qr::Redundancy::Quartile),
+				pixel,
+				max,
+				fg,
+				bg);
+			crl::on_main([=, image = std::move(image)]() mutable {
+				if (!weak || version != state->version) {
+					return;
+				}
+				state->previous = std::move(state->qr);
+				state->qr = std::move(image);
+				state->waiting.stop();
+				state->shown.stop();
+				state->shown.start(
+					[=] { result->update(); },
+					0.,
+					1.,
+					st::fadeWrapDuration);
+			});
+		});
 	}, result->lifetime());
 	std::move(
 		palettes
@@ -13,6 +13,12 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace {
 
+// Debug logs can flood from the MTProto threads and flushing to disk on
+// every entry costs much more than composing the entry itself, so the
+// debug log files are flushed at most this often. The main log is rare
+// and must survive crashes, it is still flushed on every entry.
+constexpr auto kFlushDebugLogsEach = crl::time(250);
+
 std::atomic<int> ThreadCounter/* = 0*/;
 
 } // namespace
@@ -106,11 +112,20 @@ public:
 			return;
 		}
 		file->write(msg.toUtf8());
-		file->flush();
+		if (type == LogDataMain) {
+			file->flush();
+		} else {
+			const auto now = crl::now();
+			if (now >= lastFlushed[type] + kFlushDebugLogsEach) {
+				lastFlushed[type] = now;
+				file->flush();
+			}
+		}
 	}
 
 private:
 	std::unique_ptr<QFile> files[LogDataCount];
+	crl::time lastFlushed[LogDataCount] = { 0 };
 
 	int32 part = -1;
 
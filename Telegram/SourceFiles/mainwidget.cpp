@@ -129,6 +129,9 @@ constexpr auto kSendViewsTimeout = crl::time(1000);
 // Cache background scaled image after 3s.
 constexpr auto kCacheBackgroundTimeout = 3000;
 
+// If the viewport is not changing sizes the cache can be filled fast.
+constexpr auto kCacheBackgroundFastTimeout = 100;
+
 enum class DataIsLoadedResult {
 	NotLoaded = 0,
 	FromNotLoaded = 1,
@@ -1305,9 +1308,14 @@ QPixmap MainWidget::cachedBackground(const QRect &forRect, int &x, int &y) {
 		y = _cachedY;
 		return _cachedBackground;
 	}
-	if (_willCacheFor != forRect || !_cacheBackgroundTimer.isActive()) {
+	if (_willCacheFor != forRect) {
 		_willCacheFor = forRect;
 		_cacheBackgroundTimer.callOnce(kCacheBackgroundTimeout);
+	} else if (!_cacheBackgroundTimer.isActive()) {
+		// The rect is stable, so this is a theme or background change,
+		// not a resize in progress - prepare the scaled image quickly
+		// instead of painting the slow fallback for the whole timeout.
+		_cacheBackgroundTimer.callOnce(kCacheBackgroundFastTimeout);
 	}
 	return QPixmap();
 }
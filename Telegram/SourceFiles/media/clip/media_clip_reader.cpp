@@ -33,6 +33,12 @@ namespace {
 QVector<QThread*> threads;
 QVector<Manager*> managers;
 
+int ThreadsCountLimit() {
+	// Don't oversubscribe the cores: with many autoplaying gifs all of
+	// them start to stutter, so several clips share a decoding thread.
+	return std::clamp(QThread::idealThreadCount(), 1, int(ClipThreadsCount));
+}
+
 QImage PrepareFrameImage(const FrameRequest &request, const QImage &original, bool hasAlpha, QImage &cache) {
 	auto needResize = (original.width() != request.framew) || (original.height() != request.frameh);
 	auto needOuterFill = (request.outerw != request.framew) || (request.outerh != request.frameh);
@@ -116,7 +122,7 @@ Reader::Reader(const QByteArray &data, Callback &&callback, Mode mode, crl::time
 }
 
 void Reader::init(const FileLocation &location, const QByteArray &data) {
-	if (threads.size() < ClipThreadsCount) {
+	if (threads.size() < ThreadsCountLimit()) {
 		_threadIndex = threads.size();
 		threads.push_back(new QThread());
 		managers.push_back(new Manager(threads.back()));
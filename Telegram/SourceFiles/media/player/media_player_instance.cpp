@@ -8,6 +8,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "media/player/media_player_instance.h"
 
 #include "data/data_document.h"
+#include "data/data_document_media.h"
 #include "data/data_session.h"
 #include "data/data_streaming.h"
 #include "media/audio/media_audio.h"
@@ -223,6 +224,33 @@ void Instance::playlistUpdated(not_null<Data*> data) {
 		data->playlistIndex = std::nullopt;
 	}
 	data->playlistChanges.fire({});
+	preloadNext(data);
+}
+
+void Instance::preloadNext(not_null<Data*> data) {
+	if (!data->current || !data->playlistIndex) {
+		return;
+	}
+	const auto item = itemByIndex(data, *data->playlistIndex + 1);
+	if (!item) {
+		return;
+	}
+	const auto media = item->media();
+	const auto document = media ? media->document() : nullptr;
+	if (!document
+		|| !(document->isAudioFile()
+			|| document->isVoiceMessage()
+			|| document->isVideoMessage())) {
+		return;
+	}
+	const auto view = document->createMediaView();
+	if (view->loaded(true) || document->loading()) {
+		return;
+	}
+	// Start downloading the next track in the playlist right away,
+	// so switching to it doesn't wait on the network.
+	document->save(item->fullId(), QString());
+	data->nextPreload = view;
 }
 
 bool Instance::validPlaylist(not_null<Data*> data) {
@@ -12,6 +12,10 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 class AudioMsgId;
 class DocumentData;
 
+namespace Data {
+class DocumentMedia;
+} // namespace Data
+
 namespace Media {
 namespace Audio {
 class Instance;
@@ -187,6 +191,7 @@ private:
 		bool isPlaying = false;
 		bool resumeOnCallEnd = false;
 		std::unique_ptr<Streamed> streamed;
+		std::shared_ptr<::Data::DocumentMedia> nextPreload;
 	};
 
 	Instance();
@@ -215,6 +220,7 @@ private:
 	bool validPlaylist(not_null<Data*> data);
 	void validatePlaylist(not_null<Data*> data);
 	void playlistUpdated(not_null<Data*> data);
+	void preloadNext(not_null<Data*> data);
 	bool moveInPlaylist(not_null<Data*> data, int delta, bool autonext);
 	HistoryItem *itemByIndex(not_null<Data*> data, int index);
 
@@ -55,6 +55,7 @@ int File::Context::read(bytes::span buffer) {
 
 	buffer = buffer.subspan(0, amount);
 	while (!_reader->fill(_offset, buffer, &_semaphore)) {
+		_starved = true;
 		processQueuedPackets(SleepPolicy::Disallowed);
 		_delegate->fileWaitingForData();
 		_semaphore.acquire();
@@ -144,7 +145,9 @@ Stream File::Context::initStream(
 		}
 	}
 
-	result.codec = FFmpeg::MakeCodecPointer(info);
+	result.codec = FFmpeg::MakeCodecPointer(
+		info,
+		(type == AVMEDIA_TYPE_VIDEO));
 	if (!result.codec) {
 		if (info->codecpar->codec_id == AV_CODEC_ID_MJPEG) {
 			// mp3 files contain such "video stream", just ignore it.
@@ -308,6 +311,11 @@ void File::Context::readNextPacket() {
 		i->second.push_back(std::move(*packet));
 		if (i->second.size() == kMaxQueuedPackets) {
 			processQueuedPackets(SleepPolicy::Allowed);
+		} else if (base::take(_starved)) {
+			// The tracks were starved while we waited for the reader, so
+			// hand them the first packets right away instead of keeping
+			// them hungry till the whole batch accumulates.
+			processQueuedPackets(SleepPolicy::Allowed);
 		}
 		Assert(i->second.size() < kMaxQueuedPackets);
 	} else {
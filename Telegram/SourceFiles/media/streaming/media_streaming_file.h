@@ -96,6 +96,7 @@ private:
 		int _size = 0;
 		bool _failed = false;
 		bool _readTillEnd = false;
+		bool _starved = false;
 		std::optional<bool> _fullInCache;
 		crl::semaphore _semaphore;
 		std::atomic<bool> _interrupted = false;
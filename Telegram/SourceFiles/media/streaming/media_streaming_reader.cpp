@@ -27,6 +27,12 @@ constexpr auto kSlicesInMemory = 2;
 constexpr auto kPreloadPartsAhead = 8;
 constexpr auto kDownloaderRequestsLimit = 4;
 
+// Adaptive readahead tries to keep that much future playback data
+// requested, measuring the consumption speed over the check window.
+constexpr auto kReadaheadDuration = 5 * crl::time(1000);
+constexpr auto kReadSpeedWindow = 2 * crl::time(1000);
+constexpr auto kMaxReadaheadParts = kPartsInSlice / 2;
+
 using PartsMap = base::flat_map<int, QByteArray>;
 
 struct ParsedCacheEntry {
@@ -666,6 +672,35 @@ QByteArray Reader::Slices::partForDownloader(int offset) const {
 	return (i != end(slice.parts)) ? i->second : QByteArray();
 }
 
+auto Reader::Slices::offsetsForReadahead(int from, int till) const
+-> StackIntVector<Reader::kLoadFromRemoteMax> {
+	auto result = StackIntVector<kLoadFromRemoteMax>();
+	if (isFullInHeader()) {
+		return result;
+	}
+	const auto cacheLoaded = [&](int sliceIndex) {
+		return (_headerMode == HeaderMode::NoCache)
+			|| (_data[sliceIndex].flags & Slice::Flag::LoadedFromCache);
+	};
+	accumulate_min(till, _size);
+	for (auto offset = from; offset < till; offset += kPartSize) {
+		const auto index = offset / kInSlice;
+		if (!cacheLoaded(index)) {
+			// Don't download parts that may be waiting in the cache.
+			break;
+		} else if (_header.parts.contains(offset)) {
+			continue;
+		}
+		const auto &parts = _data[index].parts;
+		if (parts.contains(offset - index * kInSlice)) {
+			continue;
+		} else if (!result.add(offset)) {
+			break;
+		}
+	}
+	return result;
+}
+
 bool Reader::Slices::waitingForHeaderCache() const {
 	return (_header.flags & Slice::Flag::LoadingFromCache);
 }
@@ -1242,6 +1277,7 @@ bool Reader::fill(
 	if (_streamingError) {
 		return failed();
 	}
+	refreshReadahead(offset, offset + int(buffer.size()));
 
 	do {
 		if (fillFromSlices(offset, buffer)) {
@@ -1254,6 +1290,56 @@ bool Reader::fill(
 	return _streamingError ? failed() : false;
 }
 
+void Reader::refreshReadahead(int offset, int till) {
+	if (_slices.headerModeUnknown() || _slices.isFullInHeader()) {
+		return;
+	}
+	const auto now = crl::now();
+	const auto seeked = (offset != _expectedFillOffset);
+	if (seeked) {
+		// A jump in reading (seek / scrubbing), shrink the window back
+		// and start measuring the consumption speed from scratch.
+		_readSpeedSince = now;
+		_readSpeedBytes = 0;
+		_readaheadParts = kPreloadPartsAhead;
+	} else {
+		_readSpeedBytes += (till - offset);
+		const auto elapsed = now - _readSpeedSince;
+		if (elapsed >= kReadSpeedWindow) {
+			const auto perSecond = _readSpeedBytes
+				* crl::time(1000)
+				/ elapsed;
+			const auto wanted = 1 + int(perSecond
+				* kReadaheadDuration
+				/ crl::time(1000)
+				/ kPartSize);
+			_readaheadParts = std::clamp(
+				wanted,
+				kPreloadPartsAhead,
+				kMaxReadaheadParts);
+			_readSpeedSince = now;
+			_readSpeedBytes = 0;
+		}
+	}
+	const auto wasExpected = std::exchange(_expectedFillOffset, till);
+	const auto tillPart = (till + kPartSize - 1) / kPartSize;
+	const auto from = (tillPart + kPreloadPartsAhead) * kPartSize;
+	const auto windowTill = (tillPart + _readaheadParts) * kPartSize;
+	if (seeked && wasExpected >= 0 && windowTill < size()) {
+		// Loads queued for the previous position won't help playback
+		// from the new one, free the connection for the new window.
+		cancelLoadInRange(windowTill, size());
+	}
+	if (from >= windowTill || from >= size()) {
+		return;
+	}
+	for (const auto offset : _slices.offsetsForReadahead(
+			from,
+			windowTill).values()) {
+		loadAtOffset(offset);
+	}
+}
+
 bool Reader::fillFromSlices(int offset, bytes::span buffer) {
 	using namespace rpl::mappers;
 
@@ -160,6 +160,12 @@ private:
 		[[nodiscard]] QByteArray partForDownloader(int offset) const;
 		[[nodiscard]] bool readCacheForDownloaderRequired(int offset);
 
+		// Get up to kLoadFromRemoteMax not loaded parts in from-till
+		// range, skipping slices that may still have data in the cache.
+		[[nodiscard]] StackIntVector<kLoadFromRemoteMax> offsetsForReadahead(
+			int from,
+			int till) const;
+
 	private:
 		enum class HeaderMode {
 			Unknown,
@@ -210,6 +216,7 @@ private:
 	bool checkForSomethingMoreReceived();
 
 	bool fillFromSlices(int offset, bytes::span buffer);
+	void refreshReadahead(int offset, int till);
 
 	void finalizeCache();
 
@@ -254,6 +261,12 @@ private:
 	int _realPriority = 1;
 	bool _streamingActive = false;
 
+	// Streaming thread. Adaptive readahead state, refreshed on each fill.
+	crl::time _readSpeedSince = 0;
+	int _readSpeedBytes = 0;
+	int _readaheadParts = 0;
+	int _expectedFillOffset = -1;
+
 	// Streaming thread.
 	std::deque<int> _offsetsForDownloader;
 	base::flat_set<int> _downloaderOffsetsRequested;
@@ -11,6 +11,10 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ui/image/image_prepare.h"
 #include "ffmpeg/ffmpeg_utility.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+} // extern "C"
+
 namespace Media {
 namespace Streaming {
 namespace {
@@ -108,6 +112,31 @@ QImage ConvertFrame(
 		QImage storage) {
 	Expects(frame != nullptr);
 
+	if (frame->hw_frames_ctx) {
+		// The frame data still lives in a GPU surface,
+		// download it into a plain software frame first.
+		if (!stream.transferred) {
+			stream.transferred = FFmpeg::MakeFramePointer();
+		}
+		const auto software = stream.transferred.get();
+		const auto error = FFmpeg::AvErrorWrap(av_hwframe_transfer_data(
+			software,
+			frame,
+			0));
+		if (error) {
+			FFmpeg::LogError(qstr("av_hwframe_transfer_data"), error);
+			av_frame_unref(frame);
+			return QImage();
+		}
+		auto result = ConvertFrame(
+			stream,
+			software,
+			resize,
+			std::move(storage));
+		av_frame_unref(frame);
+		return result;
+	}
+
 	const auto frameSize = QSize(frame->width, frame->height);
 	if (frameSize.isEmpty()) {
 		LOG(("Streaming Error: Bad frame size %1,%2"
@@ -186,7 +186,7 @@ void PaintImageProfile(QPainter &p, const QImage &image, QRect rect, QRect fill)
 	});
 }
 
-QPixmap PrepareStaticImage(const QString &path) {
+QImage PrepareStaticImage(const QString &path) {
 	auto image = App::readImage(path, nullptr, false);
 #if defined Q_OS_MAC && !defined OS_MAC_OLD
 	if (image.width() > kMaxDisplayImageSize
@@ -198,7 +198,7 @@ QPixmap PrepareStaticImage(const QString &path) {
 			Qt::SmoothTransformation);
 	}
 #endif // Q_OS_MAC && !OS_MAC_OLD
-	return App::pixmapFromImageInPlace(std::move(image));
+	return image;
 }
 
 } // namespace
@@ -1103,6 +1103,7 @@ OverlayWidget::~OverlayWidget() {
 }
 
 void OverlayWidget::assignMediaPointer(DocumentData *document) {
+	++_staticImageLoadingId;
 	_photo = nullptr;
 	_photoMedia = nullptr;
 	if (_document != document) {
@@ -1117,6 +1118,7 @@ void OverlayWidget::assignMediaPointer(DocumentData *document) {
 }
 
 void OverlayWidget::assignMediaPointer(not_null<PhotoData*> photo) {
+	++_staticImageLoadingId;
 	_document = nullptr;
 	_documentMedia = nullptr;
 	if (_photo != photo) {
@@ -2035,7 +2037,11 @@ void OverlayWidget::displayDocument(
 				if (location.accessEnable()) {
 					const auto &path = location.name();
 					if (QImageReader(path).canRead()) {
-						_staticContent = PrepareStaticImage(path);
+						// The viewer opens at once with the thumbnail,
+						// the full image is decoded on a worker thread
+						// and swapped in when it is ready.
+						initStreamingThumbnail();
+						startStaticImageLoading();
 					}
 				}
 				location.accessDisable();
@@ -2156,6 +2162,44 @@ void OverlayWidget::displayFinished() {
 	}
 }
 
+void OverlayWidget::startStaticImageLoading() {
+	Expects(_document != nullptr);
+
+	const auto id = ++_staticImageLoadingId;
+	const auto weak = Ui::MakeWeak(this);
+	auto location = std::make_unique<FileLocation>(_document->location());
+	crl::async([=, location = std::move(location)] {
+		auto image = QImage();
+		if (location->accessEnable()) {
+			image = PrepareStaticImage(location->name());
+			location->accessDisable();
+		}
+		crl::on_main(weak, [=, result = std::move(image)]() mutable {
+			if (id != _staticImageLoadingId) {
+				return;
+			}
+			staticImageLoaded(std::move(result));
+		});
+	});
+}
+
+void OverlayWidget::staticImageLoaded(QImage &&image) {
+	if (image.isNull()) {
+		return;
+	}
+	_staticContent = App::pixmapFromImageInPlace(std::move(image));
+	_staticContent.setDevicePixelRatio(cRetinaFactor());
+	const auto size = style::ConvertScale(
+		flipSizeByRotation(_staticContent.size()));
+	if (QSize(_w, _h) != size) {
+		_w = size.width();
+		_h = size.height();
+		contentSizeChanged();
+	}
+	updateControls();
+	update();
+}
+
 bool OverlayWidget::initStreaming(bool continueStreaming) {
 	Expects(_document != nullptr);
 	Expects(_documentMedia->canBePlayed());
@@ -3484,7 +3528,9 @@ void OverlayWidget::preloadData(int delta) {
 	if (!_index) {
 		return;
 	}
-	auto from = *_index + (delta ? delta : -1);
+	// Keep one entity loaded against the move direction as well,
+	// so stepping back right after stepping forward shows instantly.
+	auto from = *_index + (delta ? -delta : -1);
 	auto till = *_index + (delta ? delta * kPreloadCount : 1);
 	if (from > till) std::swap(from, till);
 
@@ -290,6 +290,9 @@ private:
 	void destroyThemePreview();
 	void updateThemePreviewGeometry();
 
+	void startStaticImageLoading();
+	void staticImageLoaded(QImage &&image);
+
 	void documentUpdated(DocumentData *doc);
 	void changingMsgId(not_null<HistoryItem*> row, MsgId newId);
 
@@ -404,6 +407,7 @@ private:
 	bool _pressed = false;
 	int32 _dragging = 0;
 	QPixmap _staticContent;
+	uint64 _staticImageLoadingId = 0;
 	bool _blurred = true;
 
 	std::unique_ptr<Streamed> _streamed;
@@ -45,6 +45,7 @@ constexpr auto kExportMediaDcShift = 0x05;
 constexpr auto kMaxMediaDcCount = 0x10;
 constexpr auto kBaseDownloadDcShift = 0x10;
 constexpr auto kBaseUploadDcShift = 0x20;
+constexpr auto kBaseParallelDcShift = 0x30;
 constexpr auto kDestroyKeyStartDcShift = 0x100;
 
 constexpr DcId BareDcId(ShiftedDcId shiftedDcId) {
@@ -97,6 +97,34 @@ constexpr bool isUploadDcId(ShiftedDcId shiftedDcId) {
 		&& (shiftedDcId < details::uploadDcId(0, kUploadSessionsCount - 1) + kDcShift);
 }
 
+constexpr auto kParallelSessionsLimit = 8;
+
+namespace details {
+
+constexpr ShiftedDcId parallelDcId(DcId dcId, int index) {
+	static_assert(
+		kParallelSessionsLimit <= kMaxMediaDcCount,
+		"Too large kParallelSessionsLimit!");
+	return ShiftDcId(dcId, kBaseParallelDcShift + index);
+}
+
+} // namespace details
+
+// send(req, callbacks, MTP::parallelDcId(index)) - for an extra
+// parallel session over the main dc, opt-in for mass-fetch workloads
+// that should not queue behind the single generic session
+// (see Instance::nextParallelDcId() for round-robin distribution)
+inline ShiftedDcId parallelDcId(int index) {
+	Expects(index >= 0 && index < kParallelSessionsLimit);
+
+	return details::parallelDcId(0, index);
+}
+
+constexpr bool isParallelDcId(ShiftedDcId shiftedDcId) {
+	return (shiftedDcId >= details::parallelDcId(0, 0))
+		&& (shiftedDcId < details::parallelDcId(0, kParallelSessionsLimit - 1) + kDcShift);
+}
+
 inline ShiftedDcId destroyKeyNextDcId(ShiftedDcId shiftedDcId) {
 	const auto shift = GetDcIdShift(shiftedDcId);
 	return ShiftDcId(BareDcId(shiftedDcId), shift ? (shift + 1) : kDestroyKeyStartDcShift);
@@ -13,6 +13,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "mtproto/session.h"
 #include "mtproto/dc_options.h"
 #include "mtproto/config_loader.h"
+#include "mtproto/facade.h"
 #include "mtproto/sender.h"
 #include "storage/localstorage.h"
 #include "calls/calls_instance.h"
@@ -95,6 +96,9 @@ public:
 	void ping();
 	void cancel(mtpRequestId requestId);
 	[[nodiscard]] int32 state(mtpRequestId requestId); // < 0 means waiting for such count of ms
+	void setParallelSessionsCount(int count);
+	[[nodiscard]] ShiftedDcId nextParallelDcId(DcId dcId);
+
 	void killSession(ShiftedDcId shiftedDcId);
 	void stopSession(ShiftedDcId shiftedDcId);
 	void reInitConnection(DcId dcId);
@@ -209,6 +213,9 @@ private:
 	rpl::event_stream<DcId> _dcTemporaryKeyChanged;
 
 	Session *_mainSession = nullptr;
+	int _parallelSessionsCount = 1;
+	base::flat_map<DcId, int> _parallelSessionIndexByDc;
+
 	base::flat_map<ShiftedDcId, std::unique_ptr<Session>> _sessions;
 	std::vector<std::unique_ptr<Session>> _sessionsToDestroy;
 	rpl::event_stream<ShiftedDcId> _restartsByTimeout;
@@ -583,6 +590,20 @@ int32 Instance::Private::state(mtpRequestId requestId) {
 	return session->requestState(0);
 }
 
+void Instance::Private::setParallelSessionsCount(int count) {
+	_parallelSessionsCount = std::clamp(count, 1, kParallelSessionsLimit);
+}
+
+ShiftedDcId Instance::Private::nextParallelDcId(DcId dcId) {
+	if (_parallelSessionsCount <= 1) {
+		return dcId;
+	}
+	auto &index = _parallelSessionIndexByDc[dcId];
+	const auto result = details::parallelDcId(dcId, index);
+	index = (index + 1) % _parallelSessionsCount;
+	return result;
+}
+
 void Instance::Private::killSession(ShiftedDcId shiftedDcId) {
 	const auto checkIfMainAndKill = [&](ShiftedDcId shiftedDcId) {
 		if (const auto removed = removeSession(shiftedDcId)) {
@@ -1730,6 +1751,14 @@ int32 Instance::state(mtpRequestId requestId) { // < 0 means waiting for such co
 	return _private->state(requestId);
 }
 
+void Instance::setParallelSessionsCount(int count) {
+	_private->setParallelSessionsCount(count);
+}
+
+ShiftedDcId Instance::nextParallelDcId(DcId dcId) {
+	return _private->nextParallelDcId(dcId);
+}
+
 void Instance::killSession(ShiftedDcId shiftedDcId) {
 	_private->killSession(shiftedDcId);
 }
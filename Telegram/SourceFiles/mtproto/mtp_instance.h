@@ -83,6 +83,13 @@ public:
 	void cancel(mtpRequestId requestId);
 	int32 state(mtpRequestId requestId); // < 0 means waiting for such count of ms
 
+	// Main thread. Opt-in parallel sessions over one dc: requests sent
+	// to nextParallelDcId() are distributed round-robin over up to
+	// "count" sessions instead of queueing behind the single generic
+	// session. With count <= 1 the generic session is used as before.
+	void setParallelSessionsCount(int count);
+	[[nodiscard]] ShiftedDcId nextParallelDcId(DcId dcId = 0);
+
 	// Main thread.
 	void killSession(ShiftedDcId shiftedDcId);
 	void stopSession(ShiftedDcId shiftedDcId);
@@ -40,6 +40,7 @@ constexpr auto kTestModeDcIdShift = 10000;
 constexpr auto kCheckSentRequestsEach = 1 * crl::time(1000);
 constexpr auto kKeyOldEnoughForDestroy = 60 * crl::time(1000);
 constexpr auto kSentContainerLives = 600 * crl::time(1000);
+constexpr auto kLargeBodyThresholdInts = 64 * 1024 / kIntSize;
 constexpr auto kFastRequestDuration = crl::time(500);
 
 // If we can't connect for this time we will ask _instance to update config.
@@ -157,7 +158,10 @@ void SessionPrivate::appendTestConnection(
 
 	const auto priority = (qthelp::is_ipv6(ip) ? 0 : 1)
 		+ (protocol == DcOptions::Variants::Tcp ? 1 : 0)
-		+ (protocolSecret.empty() ? 0 : 1);
+		+ (protocolSecret.empty() ? 0 : 1)
+		+ ((!ip.isEmpty()
+			&& ip == _lastConnectedIp
+			&& port == _lastConnectedPort) ? 8 : 0);
 	_testConnections.push_back({
 		AbstractConnection::Create(
 			_instance,
@@ -165,7 +169,9 @@ void SessionPrivate::appendTestConnection(
 			thread(),
 			protocolSecret,
 			_options->proxy),
-		priority
+		priority,
+		ip,
+		port
 	});
 	const auto weak = _testConnections.back().data.get();
 	connect(weak, &AbstractConnection::error, [=](int errorCode) {
@@ -568,7 +574,34 @@ void SessionPrivate::tryToSend() {
 			).arg(state));
 	}
 
-	if (!sendOnlyFirstPing) {
+	// A single large body (e.g. an upload part) goes out standalone and
+	// zero-copy: its buffer already has the header slots reserved and is
+	// encrypted in place. Attaching even one service message would force
+	// a container and a full copy of the body, so in that case the
+	// service queues keep their data and it rides with the next packet.
+	// Scatter-gather down to the socket is not possible with MTProto,
+	// the whole plaintext must be contiguous for the msg_key hash and
+	// AES-IGE, so avoiding the container copy is the win available here.
+	auto attachServices = true;
+	if (!sendOnlyFirstPing
+		&& sendAll
+		&& !pingRequest
+		&& !_connection->usingHttpWait()
+		&& (_bindMsgId || !_keyCreator || !_keyCreator->readyToBind())) {
+		QReadLocker locker(_sessionData->toSendMutex());
+		const auto &toSend = _sessionData->toSendMap();
+		if (toSend.size() == 1) {
+			const auto &single = toSend.begin()->second;
+			if (single->size() >= kLargeBodyThresholdInts
+				&& !single->forceSendInContainer
+				&& !single->after
+				&& !(needsLayer && single->needsLayer)) {
+				attachServices = false;
+			}
+		}
+	}
+
+	if (!sendOnlyFirstPing && attachServices) {
 		if (!_ackRequestData.isEmpty()) {
 			ackRequest = SerializedRequest::Serialize(MTPMsgsAck(
 				MTP_msgs_ack(MTP_vector<MTPlong>(
@@ -2231,6 +2264,8 @@ void SessionPrivate::onConnected(
 	} else {
 		DEBUG_LOG(("MTP Info: connection through IPv4 succeed."));
 		_waitForBetterTimer.cancel();
+		_lastConnectedIp = i->ip;
+		_lastConnectedPort = i->port;
 		_connection = std::move(i->data);
 		_testConnections.clear();
 		checkAuthKey();
@@ -2267,6 +2302,8 @@ void SessionPrivate::confirmBestConnection() {
 	DEBUG_LOG(("MTP Info: can't connect through better, using %1."
 		).arg(i->data->tag()));
 
+	_lastConnectedIp = i->ip;
+	_lastConnectedPort = i->port;
 	_connection = std::move(i->data);
 	_testConnections.clear();
 
@@ -57,6 +57,8 @@ private:
 	struct TestConnection {
 		ConnectionPointer data;
 		int priority = 0;
+		QString ip;
+		int port = 0;
 	};
 	struct SentContainer {
 		crl::time sent = 0;
@@ -188,6 +190,11 @@ private:
 	std::vector<TestConnection> _testConnections;
 	crl::time _startedConnectingAt = 0;
 
+	// The endpoint that won the last connection race gets top priority
+	// on reconnect, so a slow preferred path is not waited for again.
+	QString _lastConnectedIp;
+	int _lastConnectedPort = 0;
+
 	base::Timer _retryTimer; // exp retry timer
 	int _retryTimeout = 1;
 	qint64 _retryWillFinish = 0;
@@ -126,6 +126,12 @@ auto GenerateCodes() {
 	codes.emplace(qsl("export"), [](SessionController *window) {
 		window->session().data().startExport();
 	});
+	codes.emplace(qsl("cachestats"), [](SessionController *window) {
+		if (window) {
+			window->session().data().dumpCacheStats();
+			Ui::Toast::Show("Cache stats were written to 'log.txt'.");
+		}
+	});
 #if defined Q_OS_WIN || defined Q_OS_MAC
 	codes.emplace(qsl("freetype"), [](SessionController *window) {
 		auto text = cUseFreeType()
@@ -93,7 +93,7 @@ auto DownloadManagerMtproto::Queue::nextTask(bool onlyHighestPriority) const
 		? ranges::find_if(_tasks, notHighestPriority)
 		: end(_tasks);
 	const auto readyToRequest = [&](const Enqueued &enqueued) {
-		return enqueued.task->readyToRequest();
+		return enqueued.task->canRequestPart();
 	};
 	const auto first = ranges::find_if(
 		ranges::make_subrange(begin(_tasks), till),
@@ -101,6 +101,29 @@ auto DownloadManagerMtproto::Queue::nextTask(bool onlyHighestPriority) const
 	return (first != till) ? first->task.get() : nullptr;
 }
 
+bool DownloadManagerMtproto::Queue::preemptForHighestPriority() {
+	// Called when all session budgets are occupied: if the head of the
+	// queue has strictly higher priority than some task that still has
+	// parts in flight, pause one of those parts to free budget for the
+	// head. The cancelled offset is deferred inside the victim task
+	// and re-requested once capacity returns to it.
+	if (_tasks.size() < 2) {
+		return false;
+	}
+	const auto &head = _tasks.front();
+	if (head.priority <= 0 || !head.task->canRequestPart()) {
+		return false;
+	}
+	for (auto i = _tasks.rbegin(); i != _tasks.rend(); ++i) {
+		if (i->priority >= head.priority) {
+			break;
+		} else if (i->task->preemptPartRequest()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void DownloadManagerMtproto::Queue::removeSession(int index) {
 	for (const auto &enqueued : _tasks) {
 		enqueued.task->removeSession(index);
@@ -186,7 +209,8 @@ bool DownloadManagerMtproto::trySendNextPart(MTP::DcId dcId, Queue &queue) {
 			: -1;
 	}();
 	if (bestIndex < 0) {
-		return false;
+		return queue.preemptForHighestPriority()
+			&& trySendNextPart(dcId, queue);
 	}
 	const auto onlyHighestPriority = (balanceData.totalRequested > 0);
 	if (const auto task = queue.nextTask(onlyHighestPriority)) {
@@ -474,9 +498,38 @@ void DownloadMtprotoTask::refreshFileReferenceFrom(
 }
 
 void DownloadMtprotoTask::loadPart(int sessionIndex) {
+	if (!_deferredOffsets.empty()) {
+		const auto offset = _deferredOffsets.front();
+		_deferredOffsets.erase(_deferredOffsets.begin());
+		makeRequest({ offset, sessionIndex });
+		return;
+	}
 	makeRequest({ takeNextRequestOffset(), sessionIndex });
 }
 
+bool DownloadMtprotoTask::canRequestPart() const {
+	return !_deferredOffsets.empty() || readyToRequest();
+}
+
+bool DownloadMtprotoTask::preemptPartRequest() {
+	// Pause the latest in-flight part, it is the least disruptive to
+	// lose: sequential consumers wait for earlier offsets first.
+	if (_sentRequests.empty()) {
+		return false;
+	}
+	const auto i = ranges::max_element(
+		_sentRequests,
+		ranges::less(),
+		[](const auto &pair) { return pair.second.offset; });
+	if (i->first == _cdnHashesRequestId) {
+		return false;
+	}
+	const auto offset = i->second.offset;
+	cancelRequest(i->first);
+	_deferredOffsets.emplace(offset);
+	return true;
+}
+
 void DownloadMtprotoTask::removeSession(int sessionIndex) {
 	struct Redirect {
 		mtpRequestId requestId = 0;
@@ -809,7 +862,9 @@ auto DownloadMtprotoTask::finishSentRequest(
 }
 
 bool DownloadMtprotoTask::haveSentRequests() const {
-	return !_sentRequests.empty() || !_cdnUncheckedParts.empty();
+	return !_sentRequests.empty()
+		|| !_cdnUncheckedParts.empty()
+		|| !_deferredOffsets.empty();
 }
 
 bool DownloadMtprotoTask::haveSentRequestForOffset(int offset) const {
@@ -822,6 +877,7 @@ void DownloadMtprotoTask::cancelAllRequests() {
 		cancelRequest(_sentRequests.begin()->first);
 	}
 	_cdnUncheckedParts.clear();
+	_deferredOffsets.clear();
 }
 
 void DownloadMtprotoTask::cancelRequestForOffset(int offset) {
@@ -830,6 +886,7 @@ void DownloadMtprotoTask::cancelRequestForOffset(int offset) {
 		cancelRequest(i->second);
 	}
 	_cdnUncheckedParts.remove({ offset, 0 });
+	_deferredOffsets.remove(offset);
 }
 
 void DownloadMtprotoTask::cancelRequest(mtpRequestId requestId) {
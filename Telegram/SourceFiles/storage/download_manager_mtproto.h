@@ -58,6 +58,7 @@ private:
 		void resetGeneration();
 		[[nodiscard]] bool empty() const;
 		[[nodiscard]] Task *nextTask(bool onlyHighestPriority) const;
+		[[nodiscard]] bool preemptForHighestPriority();
 		void removeSession(int index);
 
 	private:
@@ -139,6 +140,8 @@ public:
 	[[nodiscard]] const Location &location() const;
 
 	[[nodiscard]] virtual bool readyToRequest() const = 0;
+	[[nodiscard]] bool canRequestPart() const;
+	[[nodiscard]] bool preemptPartRequest();
 	void loadPart(int sessionIndex);
 	void removeSession(int sessionIndex);
 
@@ -255,6 +258,10 @@ private:
 	base::flat_map<mtpRequestId, RequestData> _sentRequests;
 	base::flat_map<int, mtpRequestId> _requestByOffset;
 
+	// Offsets of parts cancelled by priority preemption, re-requested
+	// before any new offsets are taken from the subclass.
+	base::flat_set<int> _deferredOffsets;
+
 	MTP::DcId _cdnDcId = 0;
 	QByteArray _cdnToken;
 	QByteArray _cdnEncryptionKey;
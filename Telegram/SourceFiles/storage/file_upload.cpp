@@ -475,6 +475,11 @@ void Uploader::sendNext() {
 		parts.erase(part);
 	}
 	nextTimer.start(kUploadRequestInterval);
+	if (sentSize < kMaxUploadFileParallelSize) {
+		// Fill the whole parallel sending window right away, instead of
+		// growing it by a single part on each timer tick / part loaded.
+		sendNext();
+	}
 }
 
 void Uploader::cancel(const FullMsgId &msgId) {
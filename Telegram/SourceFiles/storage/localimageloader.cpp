@@ -23,6 +23,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "lang/lang_keys.h"
 #include "storage/file_download.h"
 #include "storage/storage_media_prepare.h"
+#include "ui/image/image.h"
 #include "window/themes/window_theme_preview.h"
 #include "mainwidget.h"
 #include "mainwindow.h"
@@ -33,12 +34,26 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
 namespace {
 
+constexpr auto kMaxTaskQueueWorkers = 8;
 constexpr auto kThumbnailQuality = 87;
 constexpr auto kThumbnailSize = 320;
 constexpr auto kPhotoUploadPartSize = 32 * 1024;
+constexpr auto kVideoInformationCacheLimit = 32;
 
 using Storage::ValidateThumbDimensions;
 
+struct CachedVideoInformation {
+	int64 filesize = 0;
+	int64 filemtime = 0;
+	FileMediaInformation::Video media;
+};
+
+// Extracting a video frame for the preview is expensive, so the results
+// are remembered for files attached repeatedly in one session. Guarded
+// by a mutex, because media information is read from worker threads.
+QMutex VideoInformationCacheMutex;
+base::flat_map<QString, CachedVideoInformation> VideoInformationCache;
+
 struct PreparedFileThumbnail {
 	uint64 id = 0;
 	QString name;
@@ -67,7 +82,10 @@ PreparedFileThumbnail PrepareFileThumbnail(QImage &&original) {
 			: kThumbnailSize;
 	};
 	result.image = scaled
-		? original.scaled(
+		? Images::DownscaleFast(
+			std::move(original),
+			QSize(scaledWidth(), scaledHeight())
+		).scaled(
 			scaledWidth(),
 			scaledHeight(),
 			Qt::IgnoreAspectRatio,
@@ -258,7 +276,7 @@ TaskId TaskQueue::addTask(std::unique_ptr<Task> &&task) {
 		_tasksToProcess.push_back(std::move(task));
 	}
 
-	wakeThread();
+	wakeThreads();
 
 	return result;
 }
@@ -271,20 +289,29 @@ void TaskQueue::addTasks(std::vector<std::unique_ptr<Task>> &&tasks) {
 		}
 	}
 
-	wakeThread();
+	wakeThreads();
 }
 
-void TaskQueue::wakeThread() {
-	if (!_thread) {
-		_thread = new QThread();
-
-		_worker = new TaskQueueWorker(this);
-		_worker->moveToThread(_thread);
-
-		connect(this, SIGNAL(taskAdded()), _worker, SLOT(onTaskAdded()));
-		connect(_worker, SIGNAL(taskProcessed()), this, SLOT(onTaskProcessed()));
-
-		_thread->start();
+void TaskQueue::wakeThreads() {
+	const auto pending = [&] {
+		QMutexLocker lock(&_tasksToProcessMutex);
+		return int(_tasksToProcess.size());
+	}();
+	const auto limit = std::clamp(
+		QThread::idealThreadCount(),
+		1,
+		kMaxTaskQueueWorkers);
+	while (int(_threads.size()) < std::min(limit, pending)) {
+		const auto thread = new QThread();
+		const auto worker = new TaskQueueWorker(this);
+		worker->moveToThread(thread);
+
+		connect(this, SIGNAL(taskAdded()), worker, SLOT(onTaskAdded()));
+		connect(worker, SIGNAL(taskProcessed()), this, SLOT(onTaskProcessed()));
+
+		thread->start();
+		_threads.push_back(thread);
+		_workers.push_back(worker);
 	}
 	if (_stopTimer) _stopTimer->stop();
 	emit taskAdded();
@@ -300,15 +327,66 @@ void TaskQueue::cancelTask(TaskId id) {
 			queue.erase(i);
 		}
 	};
+	auto dispatchFinish = false;
 	{
 		QMutexLocker lock(&_tasksToProcessMutex);
 		removeFrom(_tasksToProcess);
-		if (_taskInProcessId == id) {
-			_taskInProcessId = TaskId();
+		const auto i = ranges::find(_taskInProcessIds, id);
+		if (i != _taskInProcessIds.end()) {
+			const auto wasFront = (i == _taskInProcessIds.begin());
+			_taskInProcessIds.erase(i);
+			const auto j = ranges::find_if(_tasksFinishedOutOfOrder, [&](
+					const std::pair<TaskId, std::unique_ptr<Task>> &pair) {
+				return (pair.first == id);
+			});
+			if (j != _tasksFinishedOutOfOrder.end()) {
+				_tasksFinishedOutOfOrder.erase(j);
+			}
+			// Cancelling the task others were waiting for may release
+			// held-back finished tasks that were submitted after it.
+			if (wasFront) {
+				dispatchFinish = releaseFinishedInOrder(nullptr);
+			}
+		}
+	}
+	{
+		QMutexLocker lock(&_tasksToFinishMutex);
+		removeFrom(_tasksToFinish);
+	}
+	if (dispatchFinish) {
+		QTimer::singleShot(0, this, SLOT(onTaskProcessed()));
+	}
+}
+
+bool TaskQueue::releaseFinishedInOrder(std::unique_ptr<Task> &&task) {
+	auto release = std::vector<std::unique_ptr<Task>>();
+	if (task) {
+		release.push_back(std::move(task));
+	}
+	const auto proj = [](const std::pair<TaskId, std::unique_ptr<Task>> &pair) {
+		return pair.first;
+	};
+	while (!_taskInProcessIds.empty()) {
+		const auto i = ranges::find(
+			_tasksFinishedOutOfOrder,
+			_taskInProcessIds.front(),
+			proj);
+		if (i == _tasksFinishedOutOfOrder.end()) {
+			break;
 		}
+		release.push_back(std::move(i->second));
+		_tasksFinishedOutOfOrder.erase(i);
+		_taskInProcessIds.erase(_taskInProcessIds.begin());
+	}
+	if (release.empty()) {
+		return false;
 	}
 	QMutexLocker lock(&_tasksToFinishMutex);
-	removeFrom(_tasksToFinish);
+	const auto wasEmpty = _tasksToFinish.empty();
+	for (auto &released : release) {
+		_tasksToFinish.push_back(std::move(released));
+	}
+	return wasEmpty;
 }
 
 void TaskQueue::onTaskProcessed() {
@@ -325,24 +403,33 @@ void TaskQueue::onTaskProcessed() {
 
 	if (_stopTimer) {
 		QMutexLocker lock(&_tasksToProcessMutex);
-		if (_tasksToProcess.empty() && !_taskInProcessId) {
+		if (_tasksToProcess.empty() && _taskInProcessIds.empty()) {
 			_stopTimer->start();
 		}
 	}
 }
 
 void TaskQueue::stop() {
-	if (_thread) {
-		_thread->requestInterruption();
-		_thread->quit();
-		DEBUG_LOG(("Waiting for taskThread to finish"));
-		_thread->wait();
-		delete base::take(_worker);
-		delete base::take(_thread);
+	for (const auto thread : _threads) {
+		thread->requestInterruption();
+		thread->quit();
 	}
+	if (!_threads.empty()) {
+		DEBUG_LOG(("Waiting for task threads to finish"));
+	}
+	for (const auto thread : _threads) {
+		thread->wait();
+		delete thread;
+	}
+	for (const auto worker : _workers) {
+		delete worker;
+	}
+	_threads.clear();
+	_workers.clear();
 	_tasksToProcess.clear();
 	_tasksToFinish.clear();
-	_taskInProcessId = TaskId();
+	_taskInProcessIds.clear();
+	_tasksFinishedOutOfOrder.clear();
 }
 
 TaskQueue::~TaskQueue() {
@@ -362,7 +449,7 @@ void TaskQueueWorker::onTaskAdded() {
 			if (!_queue->_tasksToProcess.empty()) {
 				task = std::move(_queue->_tasksToProcess.front());
 				_queue->_tasksToProcess.pop_front();
-				_queue->_taskInProcessId = task->id();
+				_queue->_taskInProcessIds.push_back(task->id());
 			}
 		}
 
@@ -371,13 +458,23 @@ void TaskQueueWorker::onTaskAdded() {
 			bool emitTaskProcessed = false;
 			{
 				QMutexLocker lockToProcess(&_queue->_tasksToProcessMutex);
-				if (_queue->_taskInProcessId == task->id()) {
-					_queue->_taskInProcessId = TaskId();
+				const auto i = ranges::find(
+					_queue->_taskInProcessIds,
+					task->id());
+				if (i != _queue->_taskInProcessIds.end()) {
 					someTasksLeft = !_queue->_tasksToProcess.empty();
-
-					QMutexLocker lockToFinish(&_queue->_tasksToFinishMutex);
-					emitTaskProcessed = _queue->_tasksToFinish.empty();
-					_queue->_tasksToFinish.push_back(std::move(task));
+					if (i == _queue->_taskInProcessIds.begin()) {
+						_queue->_taskInProcessIds.erase(i);
+						emitTaskProcessed = _queue->releaseFinishedInOrder(
+							std::move(task));
+					} else {
+						// An earlier-submitted task is still processing,
+						// hold this one back so that finish() callbacks
+						// keep the submission order.
+						_queue->_tasksFinishedOutOfOrder.emplace_back(
+							task->id(),
+							std::move(task));
+					}
 				}
 			}
 			if (emitTaskProcessed) {
@@ -600,6 +697,26 @@ bool FileLoadTask::CheckForVideo(
 		return false;
 	}
 
+	auto filesize = int64(0);
+	auto filemtime = int64(0);
+	const auto cacheable = !filepath.isEmpty() && content.isEmpty();
+	if (cacheable) {
+		const auto info = QFileInfo(filepath);
+		filesize = info.size();
+		filemtime = info.lastModified().toMSecsSinceEpoch();
+		QMutexLocker lock(&VideoInformationCacheMutex);
+		const auto i = VideoInformationCache.find(filepath);
+		if (i != VideoInformationCache.end()
+			&& i->second.filesize == filesize
+			&& i->second.filemtime == filemtime) {
+			if (filepath.endsWith(qstr(".mp4"), Qt::CaseInsensitive)) {
+				result->filemime = qstr("video/mp4");
+			}
+			result->media = i->second.media;
+			return true;
+		}
+	}
+
 	auto media = Media::Clip::PrepareForSending(filepath, content);
 	if (media.duration < 0) {
 		return false;
@@ -614,6 +731,13 @@ bool FileLoadTask::CheckForVideo(
 	if (filepath.endsWith(qstr(".mp4"), Qt::CaseInsensitive)) {
 		result->filemime = qstr("video/mp4");
 	}
+	if (cacheable) {
+		QMutexLocker lock(&VideoInformationCacheMutex);
+		if (VideoInformationCache.size() >= kVideoInformationCacheLimit) {
+			VideoInformationCache.clear();
+		}
+		VideoInformationCache[filepath] = { filesize, filemtime, media };
+	}
 	result->media = std::move(media);
 	return true;
 }
@@ -854,11 +978,11 @@ void FileLoadTask::process() {
 			} else if (isAnimation) {
 				attributes.push_back(MTP_documentAttributeAnimated());
 			} else if (_type != SendMediaType::File) {
-				auto medium = (w > 320 || h > 320) ? fullimage.scaled(320, 320, Qt::KeepAspectRatio, Qt::SmoothTransformation) : fullimage;
+				auto medium = (w > 320 || h > 320) ? Images::DownscaleFast(QImage(fullimage), QSize(w, h).scaled(320, 320, Qt::KeepAspectRatio)).scaled(320, 320, Qt::KeepAspectRatio, Qt::SmoothTransformation) : fullimage;
 				photoThumbs.emplace('m', medium);
 				photoSizes.push_back(MTP_photoSize(MTP_string("m"), MTP_fileLocationToBeDeprecated(MTP_long(0), MTP_int(0)), MTP_int(medium.width()), MTP_int(medium.height()), MTP_int(0)));
 
-				auto full = (w > 1280 || h > 1280) ? fullimage.scaled(1280, 1280, Qt::KeepAspectRatio, Qt::SmoothTransformation) : fullimage;
+				auto full = (w > 1280 || h > 1280) ? Images::DownscaleFast(QImage(fullimage), QSize(w, h).scaled(1280, 1280, Qt::KeepAspectRatio)).scaled(1280, 1280, Qt::KeepAspectRatio, Qt::SmoothTransformation) : fullimage;
 				photoThumbs.emplace('y', full);
 				photoSizes.push_back(MTP_photoSize(MTP_string("y"), MTP_fileLocationToBeDeprecated(MTP_long(0), MTP_int(0)), MTP_int(full.width()), MTP_int(full.height()), MTP_int(0)));
 
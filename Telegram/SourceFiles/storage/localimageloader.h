@@ -123,14 +123,27 @@ public slots:
 private:
 	friend class TaskQueueWorker;
 
-	void wakeThread();
+	void wakeThreads();
+
+	// Appends the passed task and all held-back tasks that became
+	// releasable to _tasksToFinish, keeping the submission order.
+	// Must be called with _tasksToProcessMutex locked. Returns true
+	// if the finish queue was empty, so a dispatch is needed.
+	bool releaseFinishedInOrder(std::unique_ptr<Task> &&task);
 
 	std::deque<std::unique_ptr<Task>> _tasksToProcess;
 	std::deque<std::unique_ptr<Task>> _tasksToFinish;
-	TaskId _taskInProcessId = TaskId();
+
+	// Ids of tasks being processed, in submission order - workers
+	// take tasks from the front of _tasksToProcess under the same
+	// lock that appends the id here. A task may call finish() only
+	// when its id reaches the front, tasks completed too early wait
+	// in _tasksFinishedOutOfOrder.
+	std::vector<TaskId> _taskInProcessIds;
+	std::vector<std::pair<TaskId, std::unique_ptr<Task>>> _tasksFinishedOutOfOrder;
 	QMutex _tasksToProcessMutex, _tasksToFinishMutex;
-	QThread *_thread = nullptr;
-	TaskQueueWorker *_worker = nullptr;
+	std::vector<QThread*> _threads;
+	std::vector<TaskQueueWorker*> _workers;
 	QTimer *_stopTimer = nullptr;
 
 };
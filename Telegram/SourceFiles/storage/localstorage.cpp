@@ -46,6 +46,10 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include <QtCore/QSaveFile>
 #include <QtCore/QtEndian>
 #include <QtCore/QDirIterator>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+
+#include <deque>
 
 #ifndef Q_OS_WIN
 #include <unistd.h>
@@ -133,6 +137,57 @@ enum class FileOwner {
 	return false;
 }
 
+// Encryption and disk writes for the heavy Local::write* payloads run
+// on a background queue. The main thread only fills the plain-text
+// snapshot and hands it off, so a big stickers or locations write no
+// longer blocks the UI for the sha1 + AES + fsync part. Tasks for one
+// queue run strictly in order, which keeps writes and removals for the
+// same key from racing each other.
+class SerialWriteQueue final {
+public:
+	void enqueue(FnMut<void()> task) {
+		QMutexLocker lock(&_mutex);
+		_tasks.push_back(std::move(task));
+		if (!_processing) {
+			_processing = true;
+			crl::async([this] { process(); });
+		}
+	}
+
+	// Blocks until all enqueued tasks have finished.
+	void finish() {
+		QMutexLocker lock(&_mutex);
+		while (_processing) {
+			_finished.wait(&_mutex);
+		}
+	}
+
+private:
+	void process() {
+		while (true) {
+			auto task = FnMut<void()>();
+			{
+				QMutexLocker lock(&_mutex);
+				if (_tasks.empty()) {
+					_processing = false;
+					_finished.wakeAll();
+					return;
+				}
+				task = std::move(_tasks.front());
+				_tasks.pop_front();
+			}
+			task();
+		}
+	}
+
+	QMutex _mutex;
+	QWaitCondition _finished;
+	std::deque<FnMut<void()>> _tasks;
+	bool _processing = false;
+
+};
+SerialWriteQueue _writeQueue;
+
 [[nodiscard]] FileKey GenerateKey(FileOwner owner = FileOwner::User) {
 	if (owner == FileOwner::User) {
 		if (!_userWorking()) return 0;
@@ -163,11 +218,16 @@ void ClearKey(const FileKey &key, FileOwner owner = FileOwner::User) {
 	QString base = (owner == FileOwner::User) ? _userBasePath : _basePath, name;
 	name.reserve(base.size() + 0x11);
 	name.append(base).append(toFilePart(key)).append('0');
-	QFile::remove(name);
-	name[name.size() - 1] = '1';
-	QFile::remove(name);
-	name[name.size() - 1] = 's';
-	QFile::remove(name);
+
+	// Removals go through the write queue so that a pending async write
+	// for the same key can't land after its key was cleared.
+	_writeQueue.enqueue([name]() mutable {
+		QFile::remove(name);
+		name[name.size() - 1] = '1';
+		QFile::remove(name);
+		name[name.size() - 1] = 's';
+		QFile::remove(name);
+	});
 }
 
 bool _checkStreamStatus(QDataStream &stream) {
@@ -498,11 +558,28 @@ bool ReadFile(
 			continue;
 		}
 
-		// read data
-		QByteArray bytes = f.read(f.size());
+		// Map the rest of the file instead of reading it into an
+		// intermediate buffer. The md5 check and the payload copy then
+		// work straight over the page cache, so a cold read touches
+		// each byte once and copies out only the payload without the
+		// footer. Falls back to a plain read if mapping fails (small
+		// files, exotic filesystems).
+		const auto headerSize = qint64(tdfMagicLen) + qint64(sizeof(version));
+		uchar *mapped = (f.size() > headerSize)
+			? f.map(headerSize, f.size() - headerSize)
+			: nullptr;
+		QByteArray bytes;
+		if (mapped) {
+			bytes = QByteArray::fromRawData(
+				reinterpret_cast<const char*>(mapped),
+				int(f.size() - headerSize));
+		} else {
+			bytes = f.read(f.size());
+		}
 		int32 dataSize = bytes.size() - 16;
 		if (dataSize < 0) {
 			DEBUG_LOG(("App Info: bad file '%1', could not read sign part").arg(name));
+			if (mapped) f.unmap(mapped);
 			continue;
 		}
 
@@ -514,12 +591,20 @@ bool ReadFile(
 		md5.feed(magic, tdfMagicLen);
 		if (memcmp(md5.result(), bytes.constData() + dataSize, 16)) {
 			DEBUG_LOG(("App Info: bad file '%1', signature did not match").arg(name));
+			if (mapped) f.unmap(mapped);
 			continue;
 		}
 
-		bytes.resize(dataSize);
-		result.data = bytes;
-		bytes = QByteArray();
+		if (mapped) {
+			// Deep-copy just the payload, the mapping dies with f.
+			result.data = QByteArray(bytes.constData(), dataSize);
+			bytes = QByteArray();
+			f.unmap(mapped);
+		} else {
+			bytes.resize(dataSize);
+			result.data = bytes;
+			bytes = QByteArray();
+		}
 
 		result.version = version;
 		result.buffer.setBuffer(&result.data);
@@ -614,6 +699,27 @@ bool ReadEncryptedFile(
 	return ReadEncryptedFile(result, toFilePart(fkey), owner, key);
 }
 
+// Takes the finished plain-text snapshot out of the descriptor and
+// performs encryption and the disk write on the background queue.
+void WriteEncryptedAsync(
+		const FileKey &fkey,
+		EncryptedDescriptor &data,
+		FileOwner owner = FileOwner::User,
+		const MTP::AuthKeyPtr &key = LocalKey) {
+	data.finish();
+	_writeQueue.enqueue([
+		fkey,
+		owner,
+		key,
+		plain = std::move(data.data)
+	]() mutable {
+		EncryptedDescriptor snapshot;
+		snapshot.data = std::move(plain);
+		FileWriteDescriptor file(fkey, owner);
+		file.writeEncrypted(snapshot, key);
+	});
+}
+
 FileKey _dataNameKey = 0;
 
 enum { // Local Storage Keys
@@ -823,6 +929,140 @@ Main::Settings &GetStoredSessionSettings() {
 
 void _writeMap(WriteMapWhen when = WriteMapWhen::Soon);
 
+// Each draft map change used to reserialize and rewrite the whole map
+// file, which scales with the number of dialogs. Instead we append one
+// small encrypted record per change to a journal file and replay it
+// after the base map is read. _writeMap(WriteMapWhen::Now) still writes
+// the full map and truncates the journal, so shutdown semantics and the
+// on-disk map format are unchanged.
+//
+// The journal has the usual magic + version header but no md5 footer,
+// because an append-only file can't keep a trailing signature. Each
+// record is protected by the sha1 check inside the encrypted blob.
+constexpr auto kMapJournalLimit = 1024;
+
+qint32 _mapJournalRecords = 0;
+
+[[nodiscard]] QString _mapJournalPath() {
+	return _userBasePath + qstr("mapj");
+}
+
+void _clearMapJournal() {
+	if (!_userBasePath.isEmpty()) {
+		QFile::remove(_mapJournalPath());
+	}
+	_mapJournalRecords = 0;
+}
+
+bool _appendMapJournalRecord(quint32 keyType, quint64 key, quint64 peer) {
+	if (!_userWorking() || !LocalKey) {
+		return false;
+	}
+	if (!QDir().exists(_userBasePath)) QDir().mkpath(_userBasePath);
+
+	QFile file(_mapJournalPath());
+	const auto fresh = !file.exists();
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+		LOG(("App Error: could not open map journal for appending"));
+		return false;
+	}
+	if (fresh) {
+		file.write(tdfMagic, tdfMagicLen);
+		const auto version = qint32(AppVersion);
+		file.write((const char*)&version, sizeof(version));
+	}
+
+	EncryptedDescriptor record(sizeof(quint32) + 2 * sizeof(quint64));
+	record.stream << keyType << key << peer;
+	const auto encrypted = PrepareEncrypted(record);
+
+	const auto size = quint32(encrypted.size());
+	file.write((const char*)&size, sizeof(size));
+	file.write(encrypted);
+	file.flush();
+	file.close();
+
+	if (++_mapJournalRecords >= kMapJournalLimit) {
+		// Compact: absorb the journal into the base map.
+		_writeMap(WriteMapWhen::Fast);
+	}
+	return true;
+}
+
+void _replayMapJournal() {
+	QFile file(_mapJournalPath());
+	if (!file.exists() || !file.open(QIODevice::ReadOnly)) {
+		return;
+	}
+
+	char magic[tdfMagicLen];
+	qint32 version = 0;
+	if (file.read(magic, tdfMagicLen) != tdfMagicLen
+		|| memcmp(magic, tdfMagic, tdfMagicLen)
+		|| file.read((char*)&version, sizeof(version)) != sizeof(version)
+		|| version > AppVersion) {
+		LOG(("App Error: bad map journal header, discarding"));
+		file.close();
+		_clearMapJournal();
+		return;
+	}
+
+	auto replayed = 0;
+	while (!file.atEnd()) {
+		quint32 size = 0;
+		if (file.read((char*)&size, sizeof(size)) != sizeof(size)
+			|| !size
+			|| size > quint32(file.size())) {
+			break;
+		}
+		const auto encrypted = file.read(size);
+		if (quint32(encrypted.size()) != size) {
+			break;
+		}
+		EncryptedDescriptor record;
+		if (!decryptLocal(record, encrypted)) {
+			break;
+		}
+		quint32 keyType = 0;
+		quint64 key = 0, peer = 0;
+		record.stream >> keyType >> key >> peer;
+		if (!_checkStreamStatus(record.stream)) {
+			break;
+		}
+		switch (keyType) {
+		case lskDraft: {
+			if (key) {
+				_draftsMap.insert(peer, key);
+				_draftsNotReadMap.insert(peer, true);
+			} else {
+				_draftsMap.remove(peer);
+				_draftsNotReadMap.remove(peer);
+			}
+		} break;
+		case lskDraftPosition: {
+			if (key) {
+				_draftCursorsMap.insert(peer, key);
+			} else {
+				_draftCursorsMap.remove(peer);
+			}
+		} break;
+		default: {
+			LOG(("App Error: unknown key type in map journal: %1"
+				).arg(keyType));
+		} break;
+		}
+		++replayed;
+	}
+	file.close();
+
+	if (replayed > 0) {
+		DEBUG_LOG(("App Info: replayed %1 map journal records"
+			).arg(replayed));
+		_mapJournalRecords = replayed;
+		_mapChanged = true;
+	}
+}
+
 void _writeLocations(WriteMapWhen when = WriteMapWhen::Soon) {
 	Expects(_manager != nullptr);
 
@@ -892,8 +1132,7 @@ void _writeLocations(WriteMapWhen when = WriteMapWhen::Soon) {
 			data.stream << quint64(i.key().first) << quint64(i.key().second) << quint64(i.value().first) << quint64(i.value().second);
 		}
 
-		FileWriteDescriptor file(_locationsKey);
-		file.writeEncrypted(data);
+		WriteEncryptedAsync(_locationsKey, data);
 	}
 }
 
@@ -2512,6 +2751,9 @@ ReadMapState _readMap(const QByteArray &pass) {
 	_userSettingsKey = userSettingsKey;
 	_recentHashtagsAndBotsKey = recentHashtagsAndBotsKey;
 	_exportSettingsKey = exportSettingsKey;
+
+	_replayMapJournal();
+
 	_oldMapVersion = mapData.version;
 	if (_oldMapVersion < AppVersion) {
 		_mapChanged = true;
@@ -2666,6 +2908,7 @@ void _writeMap(WriteMapWhen when) {
 	map.writeEncrypted(mapData);
 
 	_mapChanged = false;
+	_clearMapJournal();
 }
 
 } // namespace
@@ -2674,6 +2917,7 @@ void finish() {
 	if (_manager) {
 		_writeMap(WriteMapWhen::Now);
 		_manager->finish();
+		_writeQueue.finish();
 		_manager->deleteLater();
 		_manager = nullptr;
 		delete base::take(_localLoader);
@@ -3042,7 +3286,9 @@ void writeDrafts(const PeerId &peer, const MessageDraft &localDraft, const Messa
 			ClearKey(i.value());
 			_draftsMap.erase(i);
 			_mapChanged = true;
-			_writeMap();
+			if (!_appendMapJournalRecord(lskDraft, 0, peer)) {
+				_writeMap();
+			}
 		}
 
 		_draftsNotReadMap.remove(peer);
@@ -3051,7 +3297,9 @@ void writeDrafts(const PeerId &peer, const MessageDraft &localDraft, const Messa
 		if (i == _draftsMap.cend()) {
 			i = _draftsMap.insert(peer, GenerateKey());
 			_mapChanged = true;
-			_writeMap(WriteMapWhen::Fast);
+			if (!_appendMapJournalRecord(lskDraft, i.value(), peer)) {
+				_writeMap(WriteMapWhen::Fast);
+			}
 		}
 
 		auto msgTags = TextUtilities::SerializeTags(
@@ -3083,7 +3331,9 @@ void clearDraftCursors(const PeerId &peer) {
 		ClearKey(i.value());
 		_draftCursorsMap.erase(i);
 		_mapChanged = true;
-		_writeMap();
+		if (!_appendMapJournalRecord(lskDraftPosition, 0, peer)) {
+			_writeMap();
+		}
 	}
 }
 
@@ -3205,7 +3455,9 @@ void writeDraftCursors(const PeerId &peer, const MessageCursor &msgCursor, const
 		if (i == _draftCursorsMap.cend()) {
 			i = _draftCursorsMap.insert(peer, GenerateKey());
 			_mapChanged = true;
-			_writeMap(WriteMapWhen::Fast);
+			if (!_appendMapJournalRecord(lskDraftPosition, i.value(), peer)) {
+				_writeMap(WriteMapWhen::Fast);
+			}
 		}
 
 		EncryptedDescriptor data(sizeof(quint64) + sizeof(qint32) * 3);
@@ -3563,8 +3815,7 @@ void _writeStickerSets(FileKey &stickersKey, CheckSet checkSet, const Stickers::
 	}
 	data.stream << order;
 
-	FileWriteDescriptor file(stickersKey);
-	file.writeEncrypted(data);
+	WriteEncryptedAsync(stickersKey, data);
 }
 
 void _readStickerSets(FileKey &stickersKey, Stickers::Order *outOrder = nullptr, MTPDstickerSet::Flags readingFlags = 0) {
@@ -7,6 +7,8 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 */
 #include "storage/storage_sparse_ids_list.h"
 
+#include <QtCore/QDataStream>
+
 namespace Storage {
 
 SparseIdsList::Slice::Slice(
@@ -141,6 +143,65 @@ void SparseIdsList::addSlice(
 	addRange(messageIds, noSkipRange, count);
 }
 
+QByteArray SparseIdsList::serialize() const {
+	auto size = sizeof(qint32); // slices count
+	for (const auto &slice : _slices) {
+		size += 3 * sizeof(qint32) // range, messages count
+			+ slice.messages.size() * sizeof(qint32);
+	}
+	auto result = QByteArray();
+	result.reserve(size);
+	{
+		auto stream = QDataStream(&result, QIODevice::WriteOnly);
+		stream.setVersion(QDataStream::Qt_5_1);
+		stream << qint32(_slices.size());
+		for (const auto &slice : _slices) {
+			stream
+				<< qint32(slice.range.from)
+				<< qint32(slice.range.till)
+				<< qint32(slice.messages.size());
+			for (const auto messageId : slice.messages) {
+				stream << qint32(messageId);
+			}
+		}
+	}
+	return result;
+}
+
+bool SparseIdsList::applySerialized(const QByteArray &serialized) {
+	auto stream = QDataStream(serialized);
+	stream.setVersion(QDataStream::Qt_5_1);
+	auto slicesCount = qint32();
+	stream >> slicesCount;
+	if (stream.status() != QDataStream::Ok || slicesCount < 0) {
+		return false;
+	}
+	for (auto i = 0; i != slicesCount; ++i) {
+		auto from = qint32();
+		auto till = qint32();
+		auto messagesCount = qint32();
+		stream >> from >> till >> messagesCount;
+		if (stream.status() != QDataStream::Ok
+			|| from < 0
+			|| till < from
+			|| messagesCount < 0) {
+			return false;
+		}
+		auto messages = std::vector<MsgId>();
+		messages.reserve(messagesCount);
+		for (auto j = 0; j != messagesCount; ++j) {
+			auto messageId = qint32();
+			stream >> messageId;
+			messages.push_back(messageId);
+		}
+		if (stream.status() != QDataStream::Ok) {
+			return false;
+		}
+		addSlice(std::move(messages), { from, till }, std::nullopt);
+	}
+	return true;
+}
+
 void SparseIdsList::removeOne(MsgId messageId) {
 	auto slice = ranges::lower_bound(
 		_slices,
@@ -52,6 +52,11 @@ public:
 	rpl::producer<SparseIdsListResult> query(SparseIdsListQuery &&query) const;
 	rpl::producer<SparseIdsSliceUpdate> sliceUpdated() const;
 
+	// On-disk form of the list. Only the known id ranges are persisted,
+	// the total count is not - it is always refreshed from the server.
+	[[nodiscard]] QByteArray serialize() const;
+	bool applySerialized(const QByteArray &serialized);
+
 private:
 	struct Slice {
 		Slice(base::flat_set<MsgId> &&messages, MsgRange range);
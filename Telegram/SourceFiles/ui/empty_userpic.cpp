@@ -137,27 +137,57 @@ void EmptyUserpic::paint(
 	p.drawText(QRect(x, y, size, size), _string, QTextOption(style::al_center));
 }
 
+template <typename Callback>
+void EmptyUserpic::validateCache(
+		CacheKind kind,
+		int size,
+		Callback paintBackground) const {
+	const auto key = uniqueKey();
+	if (_cacheKind == kind && _cacheSize == size && _cacheKey == key) {
+		return;
+	}
+	auto image = QImage(
+		QSize(size, size) * cIntRetinaFactor(),
+		QImage::Format_ARGB32_Premultiplied);
+	image.setDevicePixelRatio(cRetinaFactor());
+	image.fill(Qt::transparent);
+	{
+		Painter p(&image);
+		paint(p, 0, 0, size, size, [&] { paintBackground(p); });
+	}
+	_cache = App::pixmapFromImageInPlace(std::move(image));
+	_cacheKey = key;
+	_cacheSize = size;
+	_cacheKind = kind;
+}
+
 void EmptyUserpic::paint(
 		Painter &p,
 		int x,
 		int y,
 		int outerWidth,
 		int size) const {
-	paint(p, x, y, outerWidth, size, [&p, x, y, size] {
-		p.drawEllipse(x, y, size, size);
+	validateCache(CacheKind::Circle, size, [&](Painter &q) {
+		q.drawEllipse(0, 0, size, size);
 	});
+	x = rtl() ? (outerWidth - x - size) : x;
+	p.drawPixmap(x, y, _cache);
 }
 
 void EmptyUserpic::paintRounded(Painter &p, int x, int y, int outerWidth, int size) const {
-	paint(p, x, y, outerWidth, size, [&p, x, y, size] {
-		p.drawRoundedRect(x, y, size, size, st::buttonRadius, st::buttonRadius);
+	validateCache(CacheKind::Rounded, size, [&](Painter &q) {
+		q.drawRoundedRect(0, 0, size, size, st::buttonRadius, st::buttonRadius);
 	});
+	x = rtl() ? (outerWidth - x - size) : x;
+	p.drawPixmap(x, y, _cache);
 }
 
 void EmptyUserpic::paintSquare(Painter &p, int x, int y, int outerWidth, int size) const {
-	paint(p, x, y, outerWidth, size, [&p, x, y, size] {
-		p.fillRect(x, y, size, size, p.brush());
+	validateCache(CacheKind::Square, size, [&](Painter &q) {
+		q.fillRect(0, 0, size, size, q.brush());
 	});
+	x = rtl() ? (outerWidth - x - size) : x;
+	p.drawPixmap(x, y, _cache);
 }
 
 void EmptyUserpic::PaintSavedMessages(
@@ -239,14 +269,10 @@ InMemoryKey EmptyUserpic::uniqueKey() const {
 }
 
 QPixmap EmptyUserpic::generate(int size) {
-	auto result = QImage(QSize(size, size) * cIntRetinaFactor(), QImage::Format_ARGB32_Premultiplied);
-	result.setDevicePixelRatio(cRetinaFactor());
-	result.fill(Qt::transparent);
-	{
-		Painter p(&result);
-		paint(p, 0, 0, size, size);
-	}
-	return App::pixmapFromImageInPlace(std::move(result));
+	validateCache(CacheKind::Circle, size, [&](Painter &q) {
+		q.drawEllipse(0, 0, size, size);
+	});
+	return _cache;
 }
 
 void EmptyUserpic::fillString(const QString &name) {
@@ -68,6 +68,13 @@ public:
 	~EmptyUserpic();
 
 private:
+	enum class CacheKind : uchar {
+		None,
+		Circle,
+		Rounded,
+		Square,
+	};
+
 	template <typename Callback>
 	void paint(
 		Painter &p,
@@ -77,11 +84,25 @@ private:
 		int size,
 		Callback paintBackground) const;
 
+	template <typename Callback>
+	void validateCache(
+		CacheKind kind,
+		int size,
+		Callback paintBackground) const;
+
 	void fillString(const QString &name);
 
 	style::color _color;
 	QString _string;
 
+	// Rasterizing the colored shape with the letters on top is expensive
+	// enough to matter when long member lists scroll, so the last painted
+	// variant is kept as a pixmap. The key tracks palette changes.
+	mutable QPixmap _cache;
+	mutable InMemoryKey _cacheKey;
+	mutable int _cacheSize = 0;
+	mutable CacheKind _cacheKind = CacheKind::None;
+
 };
 
 } // namespace Ui
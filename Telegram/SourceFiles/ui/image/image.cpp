@@ -94,6 +94,48 @@ QImage FromInlineBytes(const QByteArray &bytes) {
 	return App::readImage(ExpandInlineBytes(bytes));
 }
 
+QImage DownscaleFast(QImage &&image, QSize toSize) {
+	if (image.isNull()
+		|| toSize.isEmpty()
+		|| image.width() < 2 * toSize.width()
+		|| image.height() < 2 * toSize.height()) {
+		return std::move(image);
+	}
+	if (image.format() != QImage::Format_ARGB32_Premultiplied
+		&& image.format() != QImage::Format_RGB32) {
+		image = std::move(image).convertToFormat(
+			QImage::Format_ARGB32_Premultiplied);
+	}
+	// Averaging packed pixels pairwise keeps each byte lane independent,
+	// so the inner loop vectorizes without unpacking the channels.
+	const auto average = [](uint32 a, uint32 b) {
+		return (a & b) + (((a ^ b) & 0xFEFEFEFEU) >> 1);
+	};
+	while (image.width() >= 2 * toSize.width()
+		&& image.height() >= 2 * toSize.height()) {
+		const auto width = image.width() / 2;
+		const auto height = image.height() / 2;
+		auto result = QImage(width, height, image.format());
+		const auto fromPerLine = image.bytesPerLine() / 4;
+		const auto toPerLine = result.bytesPerLine() / 4;
+		const auto from = reinterpret_cast<const uint32*>(image.constBits());
+		const auto to = reinterpret_cast<uint32*>(result.bits());
+		for (auto y = 0; y != height; ++y) {
+			const auto top = from + (2 * y) * fromPerLine;
+			const auto bottom = top + fromPerLine;
+			const auto line = to + y * toPerLine;
+			for (auto x = 0; x != width; ++x) {
+				line[x] = average(
+					average(top[2 * x], top[2 * x + 1]),
+					average(bottom[2 * x], bottom[2 * x + 1]));
+			}
+		}
+		result.setDevicePixelRatio(image.devicePixelRatio());
+		image = std::move(result);
+	}
+	return std::move(image);
+}
+
 QSize GetSizeForDocument(const QVector<MTPDocumentAttribute> &attributes) {
 	for (const auto &attribute : attributes) {
 		if (attribute.type() == mtpc_documentAttributeImageSize) {
@@ -448,8 +490,15 @@ QPixmap Image::pixColoredNoCache(
 		return App::pixmapFromImageInPlace(prepareColored(add, std::move(img)));
 	}
 	if (h <= 0) {
+		const auto scaledHeight = height() * w / width();
+		if (smooth) {
+			img = DownscaleFast(std::move(img), QSize(w, scaledHeight));
+		}
 		return App::pixmapFromImageInPlace(prepareColored(add, img.scaledToWidth(w, smooth ? Qt::SmoothTransformation : Qt::FastTransformation)));
 	}
+	if (smooth) {
+		img = DownscaleFast(std::move(img), QSize(w, h));
+	}
 	return App::pixmapFromImageInPlace(prepareColored(add, img.scaled(w, h, Qt::IgnoreAspectRatio, smooth ? Qt::SmoothTransformation : Qt::FastTransformation)));
 }
 
@@ -463,8 +512,10 @@ QPixmap Image::pixBlurredColoredNoCache(
 
 	auto img = prepareBlur(_data);
 	if (h <= 0) {
+		img = DownscaleFast(std::move(img), QSize(w, height() * w / width()));
 		img = img.scaledToWidth(w, Qt::SmoothTransformation);
 	} else {
+		img = DownscaleFast(std::move(img), QSize(w, h));
 		img = img.scaled(w, h, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
 	}
 
@@ -17,6 +17,12 @@ namespace Images {
 [[nodiscard]] QSize GetSizeForDocument(
 	const QVector<MTPDocumentAttribute> &attributes);
 
+// Cheaply halves the image with an integer box filter while it is still
+// at least twice as large as the target, leaving at most one final
+// smooth-scale step to the caller. A large downscale this way is several
+// times faster than a single generic smooth transform.
+[[nodiscard]] QImage DownscaleFast(QImage &&image, QSize toSize);
+
 } // namespace Images
 
 class Image final {
@@ -47,6 +47,9 @@ namespace {
 
 constexpr auto kSaveWindowPositionTimeout = crl::time(1000);
 
+// Collapse a flood of unread counter updates to roughly one per frame.
+constexpr auto kUnreadCounterUpdateDelay = crl::time(16);
+
 } // namespace
 
 QImage LoadLogo() {
@@ -126,6 +129,7 @@ QIcon CreateIcon(Main::Account *account) {
 MainWindow::MainWindow(not_null<Controller*> controller)
 : _controller(controller)
 , _positionUpdatedTimer([=] { savePosition(); })
+, _unreadCounterTimer([=] { updateUnreadCounter(); })
 , _outdated(CreateOutdatedBar(this))
 , _body(this)
 , _titleText(qsl("Telegram")) {
@@ -136,7 +140,11 @@ MainWindow::MainWindow(not_null<Controller*> controller)
 		}
 	});
 	subscribe(Global::RefUnreadCounterUpdate(), [=] {
-		updateUnreadCounter();
+		// Recomputing the badge and redrawing the taskbar icon for every
+		// single update is too expensive during update floods.
+		if (!_unreadCounterTimer.isActive()) {
+			_unreadCounterTimer.callOnce(kUnreadCounterUpdateDelay);
+		}
 	});
 	subscribe(Global::RefWorkMode(), [=](DBIWorkMode mode) {
 		workmodeUpdated(mode);
@@ -181,6 +181,7 @@ private:
 	not_null<Window::Controller*> _controller;
 
 	base::Timer _positionUpdatedTimer;
+	base::Timer _unreadCounterTimer;
 	bool _positionInited = false;
 
 	object_ptr<TitleWidget> _title = { nullptr };
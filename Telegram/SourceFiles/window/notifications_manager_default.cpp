@@ -218,6 +218,7 @@ void Manager::showNextFromQueue() {
 			queued.author,
 			queued.item,
 			queued.forwardedCount,
+			queued.messagesCount,
 			queued.fromScheduled,
 			startPosition,
 			startShift,
@@ -307,6 +308,21 @@ void Manager::removeWidget(internal::Widget *remove) {
 void Manager::doShowNotification(
 		not_null<HistoryItem*> item,
 		int forwardedCount) {
+	for (auto &queued : _queuedNotifications) {
+		if (queued.history != item->history()) {
+			continue;
+		}
+		// Notifications sit in the queue only while all the toast
+		// slots are busy, so the queued one was not shown yet and a
+		// storm from one chat can be collapsed to a counted summary.
+		queued.messagesCount += std::max(forwardedCount, 1);
+		queued.item = nullptr;
+		if (queued.author != item->notificationHeader()) {
+			queued.author = QString();
+		}
+		showNextFromQueue();
+		return;
+	}
 	_queuedNotifications.emplace_back(item, forwardedCount);
 	showNextFromQueue();
 }
@@ -531,6 +547,7 @@ Notification::Notification(
 	const QString &author,
 	HistoryItem *item,
 	int forwardedCount,
+	int messagesCount,
 	bool fromScheduled,
 	QPoint startPosition,
 	int shift,
@@ -543,6 +560,7 @@ Notification::Notification(
 , _author(author)
 , _item(item)
 , _forwardedCount(forwardedCount)
+, _messagesCount(messagesCount)
 , _fromScheduled(fromScheduled)
 , _close(this, st::notifyClose)
 , _reply(this, tr::lng_notification_reply(), st::defaultBoxButton) {
@@ -675,7 +693,9 @@ void Notification::actionsOpacityCallback() {
 }
 
 void Notification::updateNotifyDisplay() {
-	if (!_history || (!_item && _forwardedCount < 2)) return;
+	if (!_history || (!_item && _forwardedCount < 2 && _messagesCount < 2)) {
+		return;
+	}
 
 	const auto options = Manager::getNotificationOptions(_item);
 	_hideReplyButton = options.hideReplyButton;
@@ -738,18 +758,26 @@ void Notification::updateNotifyDisplay() {
 				? _item->inDialogsText(reminder
 					? HistoryItem::DrawInDialog::WithoutSender
 					: HistoryItem::DrawInDialog::Normal)
-				: ((!_author.isEmpty()
+				: (_forwardedCount > 1)
+				? ((!_author.isEmpty()
 					? textcmdLink(1, _author)
 					: QString())
-					+ (_forwardedCount > 1
-						? ('\n' + tr::lng_forward_messages(
-							tr::now,
-							lt_count,
-							_forwardedCount))
-						: QString()));
+					+ '\n' + tr::lng_forward_messages(
+						tr::now,
+						lt_count,
+						_forwardedCount))
+				: ((!_author.isEmpty()
+					? textcmdLink(1, _author) + '\n'
+					: QString())
+					+ tr::lng_notification_new_messages(
+						tr::now,
+						lt_count,
+						_messagesCount));
 			const auto Options = TextParseOptions{
 				TextParseRichText
-				| (_forwardedCount > 1 ? TextParseMultiline : 0),
+				| ((_forwardedCount > 1 || _messagesCount > 1)
+					? TextParseMultiline
+					: 0),
 				0,
 				0,
 				Qt::LayoutDirectionAuto,
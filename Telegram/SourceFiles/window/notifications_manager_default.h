@@ -101,6 +101,7 @@ private:
 		QString author;
 		HistoryItem *item = nullptr;
 		int forwardedCount = 0;
+		int messagesCount = 1;
 		bool fromScheduled = false;
 	};
 	std::deque<QueuedNotification> _queuedNotifications;
@@ -190,6 +191,7 @@ public:
 		const QString &author,
 		HistoryItem *item,
 		int forwardedCount,
+		int messagesCount,
 		bool fromScheduled,
 		QPoint startPosition,
 		int shift,
@@ -252,6 +254,7 @@ private:
 	QString _author;
 	HistoryItem *_item = nullptr;
 	int _forwardedCount = 0;
+	int _messagesCount = 1;
 	bool _fromScheduled = false;
 	object_ptr<Ui::IconButton> _close;
 	object_ptr<Ui::RoundButton> _reply;
@@ -166,6 +166,23 @@ void FiltersMenu::refresh() {
 	if (filters->list().empty() || _ignoreRefresh) {
 		return;
 	}
+	auto shown = ranges::view::all(
+		filters->list()
+	) | ranges::view::transform([](const Data::ChatFilter &filter) {
+		return std::make_tuple(
+			filter.id(),
+			filter.title(),
+			Ui::ComputeFilterIcon(filter));
+	}) | ranges::to_vector;
+
+	// Filter changes that don't touch the strip visually (like edits
+	// of the included chats list) shouldn't rebuild the buttons, the
+	// unread badges are fed by their own streams in prepareButton.
+	if (_list && shown == _shownFilters) {
+		return;
+	}
+	_shownFilters = std::move(shown);
+
 	const auto oldTop = _scroll.scrollTop();
 
 	if (!_list) {
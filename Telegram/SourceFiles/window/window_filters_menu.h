@@ -63,6 +63,7 @@ private:
 	base::unique_qptr<Ui::SideBarButton> _all;
 	base::unique_qptr<Ui::SideBarButton> _setup;
 	base::flat_map<FilterId, base::unique_qptr<Ui::SideBarButton>> _filters;
+	std::vector<std::tuple<FilterId, QString, Ui::FilterIcon>> _shownFilters;
 	FilterId _activeFilterId = 0;
 	int _reordering = 0;
 	bool _ignoreRefresh = false;